@@ -249,9 +249,16 @@ function save(){
     }
     
     var json = JSON.stringify(clockdata);
-    ajax.post("/savedata", {data : json}, function(){});
-    
-    rebootCheck = setInterval(ping, 20000);
+    // The board applies the settings without a reboot, the page is ready again when the answer arrives
+    ajax.post("/savedata", {data : json}, function(response, status){
+        var button = getItem("savebutton");
+
+        var loader = getItem("loader");
+        loader.style.display = "none";
+        if (button) {
+            button.style.display = "block";
+        }
+    });
     
 }
 
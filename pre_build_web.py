@@ -1,5 +1,8 @@
 #!/usr/bin/python
 import os
+import io
+import gzip
+import hashlib
 import subprocess
 
 input_dir = "html"              # Sub folder of webfiles
@@ -43,12 +46,20 @@ defFile.close()
 
 ##############################################
 
+# Assets are gzipped at build time. The output only depends on the content (mtime=0, sorted files),
+# so the hash and the generated file are the same on every build.
+# The hash is the ETag of the asset and it is added to the references (?v=hash), so the browser can cache them forever.
+
 f_output = open(output_file, "w")
 #URL_minify_js   = 'https://javascript-minifier.com/raw' # Website to minify javascript
 #URL_minify_html = 'https://html-minifier.com/raw'        # Website to minify html
 #URL_minify_css  = 'https://cssminifier.com/raw'         # Website to minify css
 
 f_output.write("// This file is autogenerated. DO NOT MODIFY!!!\n\n")
+f_output.write("#include <Arduino.h>\n\n")
+
+# Versioned references of the already processed assets: "/style.css" -> "/style.css?v=hash"
+asset_hashes = {}
 
 def replaceWildCards(string):
 
@@ -58,74 +69,56 @@ def replaceWildCards(string):
 
     return string
 
-def write_to_file(file, data, dir=""):
-    filename, file_extension = os.path.splitext(file)       # Split filename and file extension
-    file_extension = file_extension.replace(".","")         # Remove puncuation in file extension
+def addVersions(string):
+    for path, content_hash in asset_hashes.items():
+        for quote in ["\"", "'"]:
+            string = string.replace(quote + path + quote, quote + path + "?v=" + content_hash + quote)
+    return string
 
-    dir = dir.replace(input_dir,"")                         # Remove the first directory(input_dir)
-    dir = dir.replace("\\","/")                             # Change to /
-    if (dir == "/index."):
-        dir="/index.html"
-    f_output.write("// " + dir + "\n")                      # Print comment
-    f_output.write("const char* const data_" + filename + "_" + file_extension + "_path PROGMEM = \""+str(dir)+"\";\n")    # print path
-    f_output.write("const char data_"+filename+"_"+file_extension+"[] PROGMEM = "+data+"\n\n")            # print binary data
-
-    # f_output.write("#define data_" + filename + "_len " + str(data.count('0x')) +"\n")
-
-def aschii2Hex(text):
-    output_str = ""
-    x = 1
-    strLen = len(text)
-    for character in text:
-        output_str += hex(ord(character))
-
-        if (x != strLen):
-            output_str += ","
-        x += 1
-    return output_str
-
-def minify_js(input_file):
-    data = "R\"=====(\n"
-    sourceFile = open (input_file, "r")
-    with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    data += "\n)=====\";"
-    return data
+def gzip_bytes(data):
+    output = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", compresslevel=9, fileobj=output, mtime=0) as gzip_file:
+        gzip_file.write(data)
+    return output.getvalue()
 
-def minify_html(input_file):    
-    data = "R\"=====(\n"
-    with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    
-    data += "\n)=====\";"
-    return data
-
-def minify_css(input_file):
-    data = "R\"=====(\n"
+def write_to_file(file, data, path):
+    filename, file_extension = os.path.splitext(file)       # Split filename and file extension
+    file_extension = file_extension.replace(".","")         # Remove puncuation in file extension
+    name = "data_" + filename + "_" + file_extension
+
+    content = data.encode("utf-8")
+    content_hash = hashlib.sha256(content).hexdigest()[:16]
+    compressed = gzip_bytes(content)
+    asset_hashes[path] = content_hash
+
+    print(path + ": " + str(len(content)) + " -> " + str(len(compressed)) + " bytes")
+
+    f_output.write("// " + path + "\n")                     # Print comment
+    f_output.write("const char* const " + name + "_path PROGMEM = \""+path+"\";\n")    # print path
+    f_output.write("const char* const " + name + "_etag PROGMEM = \"\\\"" + content_hash + "\\\"\";\n")
+    f_output.write("const size_t " + name + "_len = " + str(len(compressed)) + ";\n")
+    f_output.write("const uint8_t " + name + "[] PROGMEM = {\n")
+    for start in range(0, len(compressed), 16):
+        f_output.write(",".join("0x%02x" % byte for byte in compressed[start:start + 16]))
+        f_output.write(",\n" if start + 16 < len(compressed) else "\n")
+    f_output.write("};\n\n")
+
+def minify(input_file):
     with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    
-    data += "\n)=====\";"
-    return data
-
-for root, dirs, files in os.walk(input_dir, topdown=False):
-    for name in files:   # for files
-        if name.endswith(".js"):
-            print(os.path.join(root, name))
-            minified = minify_js(os.path.join(root, name))          # minify javascript
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
-
-        elif name.endswith(".html"):
-            print(os.path.join(root, name))
-            minified = minify_html(os.path.join(root, name))        # minify html
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
-
-        elif name.endswith(".css"):
-            print(os.path.join(root, name))
-            minified = minify_css(os.path.join(root, name))         # minify css
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
-
-f_output.close()
\ No newline at end of file
+        data = replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
+    return addVersions(data)
+
+# CSS first, then JavaScript (it loads the CSS files), then HTML (it loads the JavaScript), so the references have their hashes
+assets = []
+for root, dirs, files in os.walk(input_dir):
+    dirs.sort()
+    for name in sorted(files):
+        for order, extension in enumerate([".css", ".js", ".html"]):
+            if name.endswith(extension):
+                assets.append((order, os.path.relpath(os.path.join(root, name), input_dir).replace("\\", "/"), root, name))
+
+for order, relative_path, root, name in sorted(assets):
+    print(os.path.join(root, name))
+    write_to_file(name, minify(os.path.join(root, name)), "/" + relative_path)
+
+f_output.close()
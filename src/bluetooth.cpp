@@ -4,13 +4,14 @@
 #include "BluetoothSerial.h" // Header File for Serial Bluetooth
 #include "log.cpp"
 #include "led.cpp"
+#include "utilities.cpp"
 #include <Callback.h>
 
 class BlueTooth {
 
     Log* rlog;
     String log_prefix = "[BLUE] ";        
-    Signal<String>* bluetoothMessageArrived;
+    Signal<RawMessage>* bluetoothMessageArrived;
 
     BluetoothSerial blueToothSerial; // Object for Bluetooth
     String command;
@@ -20,7 +21,7 @@ class BlueTooth {
             this -> rlog = &log;
         }
 
-        void setup(Signal<String> &bluetoothMessageArrived) {
+        void setup(Signal<RawMessage> &bluetoothMessageArrived) {
 
             this -> bluetoothMessageArrived = &bluetoothMessageArrived;
             blueToothSerial.begin(BOARD_NAME); //Name of your Bluetooth Signal
@@ -36,15 +37,30 @@ class BlueTooth {
         void loop() {
             if (blueToothSerial.available()) //Check if we receive anything from Bluetooth
             {
+                // Binary command frame
+                if (blueToothSerial.peek() == BINARY_COMMAND_MAGIC) {
+                    receiveBinaryCommand();
+                    return;
+                }
+
                 command = blueToothSerial.readString(); //Read what we recevive                 
                 command.trim();
 
                 if (!command.isEmpty()) {                    
                     rlog -> log(log_prefix, "Command received: " + command);
-                    this->bluetoothMessageArrived->fire(command);
+                    this->bluetoothMessageArrived->fire(RawMessage {command.begin(), command.length(), ""});
                 }
             }
         }
+
+    private:
+        void receiveBinaryCommand() {
+            uint8_t frame[BINARY_COMMAND_LENGTH];
+            size_t length = blueToothSerial.readBytes(frame, BINARY_COMMAND_LENGTH);
+
+            // Same route as the binary MQTT topic
+            this->bluetoothMessageArrived->fire(RawMessage {(char*) frame, length, MQTT_BINARY_POSTFIX});
+        }
 };
 
 #endif
\ No newline at end of file
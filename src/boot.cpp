@@ -0,0 +1,82 @@
+#ifndef BOOT
+#define BOOT
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+
+// Phases of the boot which are measured
+enum BootPhase : uint8_t {
+    BOOT_CONFIG_LOADED,
+    BOOT_FIRST_FRAME,
+    BOOT_WIFI_STARTED,
+    BOOT_IP_ACQUIRED,
+    BOOT_MQTT_SUBSCRIBED,
+    BOOT_PHASE_COUNT
+};
+
+static const char* const BOOT_PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "config_loaded",
+    "first_frame",
+    "wifi_started",
+    "ip_acquired",
+    "mqtt_subscribed"
+};
+
+// Time of the boot phases since the start of the chip (ms)
+// Only the first occurrence of a phase is kept, so e.g. a later MQTT reconnect does not overwrite it.
+class BootTimeline {
+
+    std::atomic<uint32_t> times[BOOT_PHASE_COUNT]; // 0 = not reached yet
+
+    BootTimeline() {
+        for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+            times[i] = 0;
+        }
+    }
+
+    static BootTimeline& instance() {
+        static BootTimeline timeline;
+        return timeline;
+    }
+
+    public:
+        // Can be called from any task
+        static void mark(BootPhase phase) {
+            uint32_t expected = 0;
+            uint32_t now = max((uint32_t) (esp_timer_get_time() / 1000), (uint32_t) 1);
+            instance().times[phase].compare_exchange_strong(expected, now);
+        }
+
+        static uint32_t get(BootPhase phase) {
+            return instance().times[phase].load();
+        }
+
+        static bool isComplete() {
+            for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+                if (get((BootPhase) i) == 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // JSON object of the phases, the ones which are not reached yet are null
+        static void serialize(char* buffer, size_t size) {
+            size_t length = snprintf(buffer, size, "{");
+            for (int i = 0; i < BOOT_PHASE_COUNT && length < size; i++) {
+                uint32_t time = get((BootPhase) i);
+                const char* separator = i > 0 ? "," : "";
+                if (time > 0) {
+                    length += snprintf(buffer + length, size - length, "%s\"%s\":%u", separator, BOOT_PHASE_NAMES[i], (unsigned int) time);
+                } else {
+                    length += snprintf(buffer + length, size - length, "%s\"%s\":null", separator, BOOT_PHASE_NAMES[i]);
+                }
+            }
+            if (length < size) {
+                snprintf(buffer + length, size - length, "}");
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef COMMAND
+#define COMMAND
+
+#include <Arduino.h>
+#include "definitions.h"
+
+// Properties of a dice command which are set (DiceCommand.fields)
+#define DICE_FIELD_COMMAND    0x01
+#define DICE_FIELD_SPEED      0x02
+#define DICE_FIELD_COUNT      0x04
+#define DICE_FIELD_INFINITY   0x08
+#define DICE_FIELD_COLOR      0x10
+#define DICE_FIELD_NUMBER     0x20
+#define DICE_FIELD_BRIGHTNESS 0x40
+
+// Commands of the dice, the value is the command number in the API
+#define DICE_COMMAND_SHOW_NUMBER 0
+#define DICE_COMMAND_ERROR 7
+#define DICE_COMMAND_COUNT 8
+
+// Module which handles a command
+enum CommandOwner : uint8_t {
+    OWNER_DATABASE,
+    OWNER_DICE
+};
+
+struct CommandRoute {
+    const char* name; // Value of the command property
+    CommandOwner owner;
+    uint8_t id; // Command number inside the module
+};
+
+static constexpr CommandRoute COMMAND_ROUTES[] = {
+    {COMMAND_CONFIG, OWNER_DATABASE, 0},
+    {"showNumber", OWNER_DICE, 0}, // Show a number on a dice 1-6
+    {"singleColor", OWNER_DICE, 1}, // set all pixels to actual color
+    {"rollTheDice", OWNER_DICE, 2}, // display a random number on the dice
+    {"rollTheDiceAnimatedToSpinUp", OWNER_DICE, 3}, // random dice numbers, spin up and finally stop at a random number
+    {"rollTheDiceAnimatedToSlowDown", OWNER_DICE, 4}, // random dice numbers, slow down and finally stop at a random number
+    {"orderRun", OWNER_DICE, 5}, // count up the dice numbers
+    {"reverseOrderRun", OWNER_DICE, 6}, // count down the dice numbers
+    {"error", OWNER_DICE, DICE_COMMAND_ERROR} // in case of error, show some noticable light
+};
+
+// Parsed command which is passed to the dice
+struct DiceCommand {
+    uint8_t fields; // DICE_FIELD_* bits of the valid properties
+    uint8_t command;
+    uint8_t number;
+    uint8_t brightness;
+    bool infinity;
+    uint16_t speed;
+    uint16_t count;
+    uint32_t color; // 0xRRGGBB
+};
+
+class CommandParser {
+
+    public:
+        // Find the route of a command name. Returns NULL if the name is unknown.
+        static const CommandRoute* findRoute(const char* name) {
+            if (name == NULL) {
+                return NULL;
+            }
+            for (const CommandRoute &route : COMMAND_ROUTES) {
+                if (strcmp(route.name, name) == 0) {
+                    return &route;
+                }
+            }
+            return NULL;
+        }
+
+        // Name of a dice command
+        static const char* getCommandName(uint8_t id) {
+            for (const CommandRoute &route : COMMAND_ROUTES) {
+                if (route.owner == OWNER_DICE && route.id == id) {
+                    return route.name;
+                }
+            }
+            return "";
+        }
+
+        // Parse a decimal integer, the whole payload must be a number (surrounding whitespaces are allowed)
+        static bool parseInteger(const char* text, size_t length, int &value) {
+            size_t i = 0;
+            while (i < length && isspace(text[i])) {
+                i++;
+            }
+            while (length > i && isspace(text[length - 1])) {
+                length--;
+            }
+
+            bool negative = i < length && text[i] == '-';
+            if (negative) {
+                i++;
+            }
+            if (i == length) {
+                return false;
+            }
+
+            int result = 0;
+            for (; i < length; i++) {
+                if (!isdigit(text[i]) || result > 100000) {
+                    return false;
+                }
+                result = result * 10 + (text[i] - '0');
+            }
+            value = negative ? -result : result;
+            return true;
+        }
+
+        // Check an integer property before it is stored in the narrower field of DiceCommand
+        // Brightness is not checked, it is clamped to 0-255.
+        static bool isInRange(uint8_t field, int value) {
+            switch (field) {
+                case DICE_FIELD_COMMAND:
+                    return value >= 0 && value < DICE_COMMAND_COUNT;
+                case DICE_FIELD_NUMBER:
+                    return value >= 1 && value <= 6;
+                case DICE_FIELD_SPEED:
+                case DICE_FIELD_COUNT:
+                    return value >= 0 && value <= UINT16_MAX;
+                case DICE_FIELD_BRIGHTNESS:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        static bool parseBoolean(const char* text, bool &value) {
+            if (strcmp(text, "true") == 0 || strcmp(text, "1") == 0) {
+                value = true;
+                return true;
+            }
+            if (strcmp(text, "false") == 0 || strcmp(text, "0") == 0) {
+                value = false;
+                return true;
+            }
+            return false;
+        }
+
+        // Parse a color code like #00FF00 (# is optional) to 0xRRGGBB
+        // Returns false if the code is not valid, the color is not changed then.
+        static bool parseColor(const char* colorCode, uint32_t &color) {
+            if (colorCode == NULL) {
+                return false;
+            }
+            if (*colorCode == '#') {
+                colorCode++;
+            }
+
+            uint32_t value = 0;
+            int length = 0;
+            for (; colorCode[length] != '\0'; length++) {
+                char c = colorCode[length];
+                if (length >= 6 || !isxdigit(c)) {
+                    return false;
+                }
+                value = (value << 4) | (isdigit(c) ? c - '0' : (toupper(c) - 'A' + 10));
+            }
+
+            if (length != 6) {
+                return false;
+            }
+            color = value;
+            return true;
+        }
+};
+
+// Binary command frame (version 1), multi-byte values are little endian
+//  0: magic (BINARY_COMMAND_MAGIC)
+//  1: version
+//  2: command number (see the command list in README)
+//  3: flags, bit 0-6: DICE_FIELD_* bits of the valid properties, bit 7: infinity
+//  4: number
+//  5: brightness
+//  6: speed (2 bytes, ms)
+//  8: count (2 bytes)
+// 10: color R, G, B
+class BinaryCommand {
+
+    public:
+        // Decode a frame without any heap use. Returns false if the frame or one of its valid fields is not valid.
+        static bool decode(const uint8_t* data, size_t length, DiceCommand &command) {
+            if (length != BINARY_COMMAND_LENGTH || data[0] != BINARY_COMMAND_MAGIC || data[1] != BINARY_COMMAND_VERSION) {
+                return false;
+            }
+
+            command.fields = data[3] & 0x7F;
+            command.command = data[2];
+            command.infinity = (data[3] & 0x80) != 0;
+            command.number = data[4];
+            command.brightness = data[5];
+            command.speed = data[6] | (data[7] << 8);
+            command.count = data[8] | (data[9] << 8);
+            command.color = ((uint32_t) data[10] << 16) | ((uint32_t) data[11] << 8) | data[12];
+
+            // The other fields cannot be out of range in their bytes
+            if ((command.fields & DICE_FIELD_COMMAND) && !CommandParser::isInRange(DICE_FIELD_COMMAND, command.command)) {
+                return false;
+            }
+            if ((command.fields & DICE_FIELD_NUMBER) && !CommandParser::isInRange(DICE_FIELD_NUMBER, command.number)) {
+                return false;
+            }
+            return true;
+        }
+};
+
+#endif
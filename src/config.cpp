@@ -0,0 +1,56 @@
+#ifndef CONFIG
+#define CONFIG
+
+#include <Arduino.h>
+#include "definitions.h"
+
+// Parts of the config which changed (bits of the config change signal)
+#define CONFIG_CHANGED_WIFI        0x01 // ssid, password
+#define CONFIG_CHANGED_MQTT_SERVER 0x02 // server, port, user, password
+#define CONFIG_CHANGED_MQTT_TOPIC  0x04 // prefix
+#define CONFIG_CHANGED_REBOOT      0x08
+#define CONFIG_CHANGED_DETAILED    0x10
+#define CONFIG_CHANGED_TELEMETRY   0x20
+
+// Typed configuration of the board
+// It is decoded from the database once at boot (and after every save), so the modules read plain fields
+// instead of looking up String keys in the JSON document.
+struct Config {
+    char ssid[CONFIG_SSID_SIZE];
+    char password[CONFIG_PASSWORD_SIZE];
+    char mqttServer[CONFIG_HOST_SIZE];
+    int mqttPort;
+    char mqttUser[CONFIG_USER_SIZE];
+    char mqttPassword[CONFIG_PASSWORD_SIZE];
+    char mqttPrefix[CONFIG_PREFIX_SIZE];
+    int rebootTimeout; // hours, 0 = never
+    bool detailed; // Detailed MQTT report
+    int telemetryInterval; // s, 0 = disabled
+
+    // CONFIG_CHANGED_* bits of the fields which are different in the other config
+    uint32_t changes(const Config &other) const {
+        uint32_t changed = 0;
+        if (strcmp(ssid, other.ssid) != 0 || strcmp(password, other.password) != 0) {
+            changed |= CONFIG_CHANGED_WIFI;
+        }
+        if (strcmp(mqttServer, other.mqttServer) != 0 || mqttPort != other.mqttPort
+            || strcmp(mqttUser, other.mqttUser) != 0 || strcmp(mqttPassword, other.mqttPassword) != 0) {
+            changed |= CONFIG_CHANGED_MQTT_SERVER;
+        }
+        if (strcmp(mqttPrefix, other.mqttPrefix) != 0) {
+            changed |= CONFIG_CHANGED_MQTT_TOPIC;
+        }
+        if (rebootTimeout != other.rebootTimeout) {
+            changed |= CONFIG_CHANGED_REBOOT;
+        }
+        if (detailed != other.detailed) {
+            changed |= CONFIG_CHANGED_DETAILED;
+        }
+        if (telemetryInterval != other.telemetryInterval) {
+            changed |= CONFIG_CHANGED_TELEMETRY;
+        }
+        return changed;
+    }
+};
+
+#endif
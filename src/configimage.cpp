@@ -0,0 +1,135 @@
+#ifndef CONFIGIMAGE
+#define CONFIGIMAGE
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <rom/crc.h>
+#include "definitions.h"
+#include "config.cpp"
+
+// Header of the binary config image
+struct ConfigImageHeader {
+    uint32_t magic;
+    uint16_t version; // Schema version of the payload
+    uint16_t length; // Length of the payload
+    uint32_t sequence; // Incremented by every write, the bank with the higher one is the newer
+    uint32_t generation; // Generation of the database records which the config is decoded from
+    uint32_t crc; // CRC32 of the header (with crc = 0) and the payload
+};
+
+static_assert(sizeof(Config) <= CONFIG_IMAGE_MAX_PAYLOAD, "Config does not fit in the image");
+
+// Binary image of the typed config in two banks (A/B)
+// The image is loaded directly into the Config struct at boot, so the JSON parser is not needed.
+// A write always goes to the older bank, so if it is broken (e.g. power loss), the other bank is still valid.
+class ConfigImage {
+
+    Preferences* store;
+    uint32_t sequence = 0;
+    uint32_t generation = 0;
+    uint8_t activeBank = 1; // Bank of the last valid image, the next write goes to the other one
+
+    public:
+        void setup(Preferences &store) {
+            this -> store = &store;
+        }
+
+        // Default values in a cleared struct
+        // The image and its CRC cover the whole struct, so the padding and the unused bytes of the texts must be zero.
+        static void defaults(Config &config) {
+            memset(&config, 0, sizeof(Config));
+            config.mqttPort = MQTT_DEFAULT_PORT;
+            config.telemetryInterval = TELEMETRY_INTERVAL;
+        }
+
+        // Generation of the records of the loaded or the last written image
+        uint32_t getGeneration() {
+            return generation;
+        }
+
+        // Load the newest valid bank, returns false if there is no valid image
+        bool read(Config &config) {
+            bool found = false;
+            for (uint8_t bank = 0; bank < 2; bank++) {
+                ConfigImageHeader header;
+                Config bankConfig;
+                if (readBank(bank, bankConfig, header) && (!found || (int32_t) (header.sequence - sequence) > 0)) {
+                    config = bankConfig;
+                    sequence = header.sequence;
+                    generation = header.generation;
+                    activeBank = bank;
+                    found = true;
+                }
+            }
+            return found;
+        }
+
+        // The config must be filled in a struct which is cleared by defaults()
+        bool write(const Config &config, uint32_t generation) {
+            uint8_t image[sizeof(ConfigImageHeader) + sizeof(Config)];
+            ConfigImageHeader header = {CONFIG_IMAGE_MAGIC, CONFIG_SCHEMA_VERSION, sizeof(Config), sequence + 1, generation, 0};
+            memcpy(image, &header, sizeof(header));
+            memcpy(image + sizeof(header), &config, sizeof(Config));
+            header.crc = crc32_le(0, image, sizeof(image));
+            memcpy(image, &header, sizeof(header));
+
+            uint8_t bank = activeBank ^ 1;
+            if (store -> putBytes(bankName(bank), image, sizeof(image)) != sizeof(image)) {
+                return false;
+            }
+            sequence = header.sequence;
+            this -> generation = generation;
+            activeBank = bank;
+            return true;
+        }
+
+    private:
+        static const char* bankName(uint8_t bank) {
+            return bank == 0 ? CONFIG_BANK_A : CONFIG_BANK_B;
+        }
+
+        bool readBank(uint8_t bank, Config &config, ConfigImageHeader &header) {
+            uint8_t image[sizeof(ConfigImageHeader) + CONFIG_IMAGE_MAX_PAYLOAD];
+            size_t length = store -> getBytesLength(bankName(bank));
+            if (length < sizeof(ConfigImageHeader) || length > sizeof(image) || store -> getBytes(bankName(bank), image, length) != length) {
+                return false;
+            }
+
+            memcpy(&header, image, sizeof(header));
+            if (header.magic != CONFIG_IMAGE_MAGIC || header.length != length - sizeof(header)) {
+                return false;
+            }
+
+            uint32_t crc = header.crc;
+            header.crc = 0;
+            memcpy(image, &header, sizeof(header));
+            if (crc32_le(0, image, length) != crc) {
+                return false;
+            }
+
+            header.crc = crc;
+            return decode(header.version, image + sizeof(header), header.length, config);
+        }
+
+        // Only the payload of the actual schema version is accepted
+        // An image of an other version is rejected, so the config is decoded from the records at boot
+        // and the image is rewritten in the actual version. The records are the source, no migration step is needed.
+        static bool decode(uint16_t version, const uint8_t* payload, size_t length, Config &config) {
+            if (version != CONFIG_SCHEMA_VERSION || length != sizeof(Config)) {
+                return false;
+            }
+
+            memcpy(&config, payload, sizeof(Config));
+
+            // Text fields are always closed
+            config.ssid[sizeof(config.ssid) - 1] = '\0';
+            config.password[sizeof(config.password) - 1] = '\0';
+            config.mqttServer[sizeof(config.mqttServer) - 1] = '\0';
+            config.mqttUser[sizeof(config.mqttUser) - 1] = '\0';
+            config.mqttPassword[sizeof(config.mqttPassword) - 1] = '\0';
+            config.mqttPrefix[sizeof(config.mqttPrefix) - 1] = '\0';
+            return true;
+        }
+};
+
+#endif
@@ -3,33 +3,84 @@
 
 // Json based library
 // data
+// Every property is a separate record in NVS. NVS is log structured: a changed record is appended,
+// the old one is only marked as erased and the pages are compacted by NVS itself, so a save writes
+// only the changed properties and a power loss cannot destroy the other ones.
+// Every property has two record slots (<name> and <name>~). A changed value is written to the inactive slot
+// and the key list, which names the active slots, is written last. This one write switches to the new set.
+// The key list has a generation, which is incremented by every switch. The config image is built from one generation,
+// it is used at boot only if it belongs to the actual one.
 
 #include "definitions.h"
 #include <EEPROM.h>
+#include <Preferences.h>
 #include <ArduinoJson.h> // version 6
+#include <Callback.h>
 #include "log.cpp"
+#include "metrics.cpp"
+#include "config.cpp"
+#include "configimage.cpp"
+#include "boot.cpp"
 
 class Database {
 
     Log* rlog;
     String log_prefix = "[STORE] ";
     StaticJsonDocument<1000> jsonData;    
+    Config config = {};
+    ConfigImage image;
+    Preferences store;
+    Signal<uint32_t>* configChanged = NULL;
+    uint32_t generation = 0; // Generation of the key list
+    bool loaded = false; // The records are loaded into the JSON document only when the web API or a config command needs them
+
+    // Write-behind: changes are committed together after a quiet period
+    bool dirty = false;
+    unsigned long firstChange = 0;
+    unsigned long lastChange = 0;
 
     public: 
         Database(Log &log) {
             this -> rlog = &log;                       
         }
 
-        void setup() {
-            EEPROM.begin(EEPROM_SIZE);
-            this->init();
+        void setup(Signal<uint32_t> &configChanged) {
+            store.begin(DB_NAMESPACE, false);
+            image.setup(store);
+
+            // Fast path, the typed config is read directly from the binary image
+            // A reset between the key list switch and the image write leaves an image of the previous generation.
+            generation = listGeneration(store.getString(DB_KEY_LIST, ""));
+            if (image.read(config) && image.getGeneration() == generation) {
+                rlog -> log(log_prefix, "Config image loaded.");
+            } else {
+                rlog -> log(log_prefix, "No valid config image for the records, decode the records.");
+                if (!store.isKey(DB_KEY_LIST)) {
+                    migrateEeprom();
+                }
+                this->init();
+            }
+
+            // Decoding at boot is not a change
+            this -> configChanged = &configChanged;
+            BootTimeline::mark(BOOT_CONFIG_LOADED);
         }
 
         void loop() {
+            if (dirty && (millis() - lastChange >= DB_WRITE_DELAY || millis() - firstChange >= DB_WRITE_MAX_DELAY)) {
+                flush();
+            }
+        }
 
+        // Commit the pending changes now, e.g. before a restart
+        void flush() {
+            if (dirty) {
+                dirty = false;
+                save();
+            }
         }
 
-        // Init EEPROM to check/set the identification
+        // Init the store to check/set the identification
         void init() {
             String name = this -> getValueAsString("name", true);
 
@@ -39,36 +90,80 @@ class Database {
                 rlog -> log(log_prefix, "Board name was not found, reinit the database.");
                 jsonData.clear();
                 this->updateProperty("name", BOARD_NAME, true);
+                flush();
             }
+            updateConfig();
+        }
+
+        // Typed config, it is up to date after every save
+        const Config& getConfig() {
+            return config;
         }
 
         // Read all from the store
         void load() {
-            String data = EEPROM.readString(0);
-            rlog -> log(log_prefix, "data loaded: " + data);
-            DeserializationError error = deserializeJson(jsonData, data);
-
-            if (error) {
-                rlog -> log(log_prefix + "DeserializationError: " + error.c_str());
-                jsonData.clear();          
-            } else {
-                rlog -> log(log_prefix, "Data successfully parsed");
+            jsonData.clear();
+            String keys = listRecords(store.getString(DB_KEY_LIST, ""));
+
+            int start = 0;
+            while (start < (int) keys.length()) {
+                int end = keys.indexOf(DB_KEY_SEPARATOR, start);
+                if (end < 0) {
+                    end = keys.length();
+                }
+                String record = keys.substring(start, end);
+                jsonData[propertyName(record)] = store.getString(record.c_str(), "");
+                start = end + 1;
             }
+            loaded = true;
+            rlog -> log(log_prefix, "data loaded: " + getSerialized());
         }
 
-        // Always rewrite all data
-        // Use it carefully
+        // Write the changed properties only
+        // A changed value goes to the inactive slot of its property, the active records are not touched.
+        // The new key list is written after the values, so a power loss leaves either the old key list
+        // with all of its old values or the new one with all of its new values.
         void save() {
+            ensureLoaded();
+            String oldList = store.getString(DB_KEY_LIST, "");
+            String oldKeys = listRecords(oldList);
+            String keys = "";
+            int written = 0;
+
+            for (JsonPair keyValue : jsonData.as<JsonObject>()) {
+                const char* key = keyValue.key().c_str();
+                if (strlen(key) > DB_KEY_MAX_LENGTH || strchr(key, DB_KEY_SEPARATOR) != NULL || strchr(key, DB_KEY_SLOT_SUFFIX) != NULL
+                    || strchr(key, DB_KEY_GENERATION_SEPARATOR) != NULL || strcmp(key, DB_KEY_LIST) == 0) {
+                    rlog -> log(log_prefix, (String) "Property name is not valid, it is not saved: " + key);
+                    continue;
+                }
 
-            String data = "";
-            serializeJson(jsonData, data);
-            
-            // Clean the store first
-            reset();
+                String value = keyValue.value().as<String>();
+                String record = findRecord(oldKeys, key);
+                if (record.length() == 0 || store.getString(record.c_str(), "") != value) {
+                    record = inactiveRecord(key, record);
+                    store.putString(record.c_str(), value);
+                    written++;
+                }
+                if (keys.length() > 0) {
+                    keys += DB_KEY_SEPARATOR;
+                }
+                keys += record;
+            }
 
-            EEPROM.writeString(0, data);
-            EEPROM.commit();
-            rlog -> log(log_prefix, "data saved: " + data);
+            if (keys != oldKeys) {
+                generation = listGeneration(oldList) + 1;
+                store.putString(DB_KEY_LIST, String(generation) + DB_KEY_GENERATION_SEPARATOR + keys);
+                written++;
+                written += removeInactiveRecords(oldKeys, keys);
+            }
+
+            if (written > 0) {
+                Metrics::increment(METRIC_DB_COMMITS);
+                Metrics::increment(METRIC_DB_RECORD_WRITES, written);
+            }
+            updateConfig();
+            rlog -> log(log_prefix, (String) "data saved, record writes: " + written);
         }
 
         void updateProperty(String property, String value) {            
@@ -76,15 +171,16 @@ class Database {
         }
 
         // Update a property in a json data strucure.
-        // Save to the store if saveValues is true
+        // Save to the store (after the write-behind delay) if saveValues is true
         void updateProperty(String property, String value, boolean saveValues) {            
             int str_len = property.length() + 1;
             char prop[str_len];
             property.toCharArray(prop, str_len);
 
+            ensureLoaded();
             this->jsonData[prop] = value;
             if (saveValues) {
-                save();             
+                markDirty();
             }
         }
 
@@ -96,6 +192,7 @@ class Database {
             if (loadbefore){
                 load();
             }            
+            ensureLoaded();
 
             if (jsonData.containsKey(name)){
                 return jsonData[name.c_str()].as<String>();
@@ -112,24 +209,18 @@ class Database {
             if (loadbefore){
                 load();
             }
-            
-            int ret = -1;
-            if (jsonData.containsKey(name)) {
-                String value = jsonData[name.c_str()].as<String>();            
-                
-                if (isNumeric(value)) {
-                    ret = value.toInt();
-                }
-            }
+            ensureLoaded();
 
-            return ret;
+            return readInt(name.c_str(), -1);
         }
 
         boolean isPropertyExists(String property) {
+            ensureLoaded();
             return jsonData.containsKey(property);
         }
 
         String getSerialized() {
+            ensureLoaded();
             String output;
             serializeJson(jsonData, output);
             return output;
@@ -144,76 +235,215 @@ class Database {
                 rlog -> log(log_prefix + (String) "DeserializationError: " + error.c_str() + " (jsonToDatabase) " + json);
             } else {
                 rlog -> log(log_prefix, "Data successfully parsed during jsonToDatabase process. Data: " + json);
-                // Save mechanism from hackers
-                // Data alaways have a name property, because the system initialize the EEPROM if the format is not correct.
-                // See the init() function
-                // Check the if name is available and it is the same az a board name. In case of matching, save the data
-                String value = tempJson["name"].as<String>();
-                
-                if (String(BOARD_NAME).equals(value)) {
-                    // update/add properties individually, overwrite the wole database remove some other properties from other settings source (MQTT ledstrip)
-                    JsonObject documentRoot = tempJson.as<JsonObject>();
-                    for (JsonPair keyValue : documentRoot) {
-                        if (strcmp(keyValue.key().c_str(),"command") != 0)
-                        this -> updateProperty(keyValue.key().c_str(), keyValue.value().as<String>());
-                    }
-                    save();
-                } else {
-                    rlog -> log(log_prefix, "Json data is not valid, database was not overwritten.");
-                }
-                
+                objectToDatabase(tempJson.as<JsonObject>());
             }
         }
 
-        void receiveCommand(String message) {
-            StaticJsonDocument<1000> tempJson; 
-            DeserializationError error = deserializeJson(tempJson, message);
-
-            if (error) {
-                rlog -> log(log_prefix + (String) "DeserializationError: " + error.c_str() + " (receiveCommand) " + message);
-            } else {               
-                String value = tempJson["command"].as<String>();                
-                if (String(COMMAND_CONFIG).equals(value)) {
-                    rlog -> log(log_prefix, (String) "Command received: " + COMMAND_CONFIG);                    
-                    this -> jsonToDatabase(message);
+        // Save the properties of an already parsed JSON object
+        void objectToDatabase(JsonObject documentRoot) {
+            // Save mechanism from hackers
+            // Data alaways have a name property, because the system initialize the EEPROM if the format is not correct.
+            // See the init() function
+            // Check the if name is available and it is the same az a board name. In case of matching, save the data
+            const char* value = documentRoot["name"];
+            
+            if (value != NULL && strcmp(BOARD_NAME, value) == 0) {
+                // update/add properties individually, overwrite the wole database remove some other properties from other settings source (MQTT ledstrip)
+                for (JsonPair keyValue : documentRoot) {
+                    if (strcmp(keyValue.key().c_str(), PROPERTY_COMMAND) != 0)
+                    this -> updateProperty(keyValue.key().c_str(), keyValue.value().as<String>());
                 }
-                
+                markDirty();
+            } else {
+                rlog -> log(log_prefix, "Json data is not valid, database was not overwritten.");
             }
         }
 
+        // Config command, it is parsed by the command router
+        void receiveConfig(JsonObject config) {
+            rlog -> log(log_prefix, (String) "Command received: " + COMMAND_CONFIG);
+            this -> objectToDatabase(config);
+        }
+
         void reset(){
             // Reset settings
-            rlog -> log(log_prefix + "Clear EEPROM");
-            for (int i = 0; i < EEPROM_SIZE; ++i) { EEPROM.write(i, 0); }
-            EEPROM.commit();
-            rlog -> log(log_prefix + "EEPROM is clean.");
+            rlog -> log(log_prefix + "Clear the store");
+            store.clear();
+            rlog -> log(log_prefix + "Store is clean.");
         }
 
     private:
-        boolean isNumeric(String str) {
-            unsigned int stringLength = str.length();
+        // A change while a commit is already pending is saved by that commit
+        void markDirty() {
+            unsigned long now = millis();
+            if (dirty) {
+                Metrics::increment(METRIC_DB_COMMITS_AVOIDED);
+            } else {
+                dirty = true;
+                firstChange = now;
+            }
+            lastChange = now;
+        }
 
-            if (stringLength == 0) {
-                return false;
+        void ensureLoaded() {
+            if (!loaded) {
+                load();
             }
+        }
 
-            boolean seenDecimal = false;
+        // Decode the document and write the binary image if the typed config is changed
+        // or the image belongs to an other generation of the records.
+        // The modules are notified about the changed parts, so they can apply them without a reboot.
+        void updateConfig() {
+            Config decoded;
+            ConfigImage::defaults(decoded);
+            decodeConfig(decoded);
+
+            uint32_t changes = decoded.changes(config);
+            if (changes != 0 || image.getGeneration() != generation) {
+                if (image.write(decoded, generation)) {
+                    Metrics::increment(METRIC_DB_RECORD_WRITES);
+                } else {
+                    rlog -> log(log_prefix, "Config image cannot be written.");
+                }
+                config = decoded;
 
-            for(unsigned int i = 0; i < stringLength; ++i) {
-                if (isDigit(str.charAt(i))) {
-                    continue;
+                if (changes != 0 && configChanged != NULL) {
+                    rlog -> log(log_prefix, (String) "Config changed: 0x" + String(changes, HEX));
+                    configChanged -> fire(changes);
                 }
+            }
+        }
 
-                if (str.charAt(i) == '.') {
-                    if (seenDecimal) {
-                        return false;
-                    }
-                    seenDecimal = true;
-                    continue;
+        // Remove the records of the old key list which are not active any more:
+        // the previous slots of the changed properties and the records of the removed ones
+        // Returns the number of the removed records
+        int removeInactiveRecords(const String &oldKeys, const String &keys) {
+            int removed = 0;
+            int start = 0;
+            while (start < (int) oldKeys.length()) {
+                int end = oldKeys.indexOf(DB_KEY_SEPARATOR, start);
+                if (end < 0) {
+                    end = oldKeys.length();
+                }
+                String record = oldKeys.substring(start, end);
+                if (findRecord(keys, propertyName(record).c_str()) != record) {
+                    store.remove(record.c_str());
+                    removed++;
+                }
+                start = end + 1;
+            }
+            return removed;
+        }
+
+        // Active record of a property in a key list, empty if the property is not in the list
+        String findRecord(const String &keys, const char* property) {
+            int start = 0;
+            while (start < (int) keys.length()) {
+                int end = keys.indexOf(DB_KEY_SEPARATOR, start);
+                if (end < 0) {
+                    end = keys.length();
+                }
+                String record = keys.substring(start, end);
+                if (propertyName(record) == property) {
+                    return record;
                 }
-                return false;
+                start = end + 1;
+            }
+            return "";
+        }
+
+        // The slot which is not active, the first one if the property has no record yet
+        String inactiveRecord(const char* property, const String &activeRecord) {
+            String record = property;
+            if (activeRecord == record) {
+                record += DB_KEY_SLOT_SUFFIX;
+            }
+            return record;
+        }
+
+        // Generation of a key list, the lists of the earlier versions have none (0)
+        static uint32_t listGeneration(const String &list) {
+            if (list.indexOf(DB_KEY_GENERATION_SEPARATOR) < 0) {
+                return 0;
+            }
+            return strtoul(list.c_str(), NULL, 10);
+        }
+
+        // Record names of a key list without the generation
+        static String listRecords(const String &list) {
+            int split = list.indexOf(DB_KEY_GENERATION_SEPARATOR);
+            return split < 0 ? list : list.substring(split + 1);
+        }
+
+        // Property name of a record name (the slot suffix is removed)
+        // The key lists of the earlier versions have no suffix, their records are the first slots.
+        String propertyName(const String &record) {
+            if (record.endsWith(String(DB_KEY_SLOT_SUFFIX))) {
+                return record.substring(0, record.length() - 1);
+            }
+            return record;
+        }
+
+        // Earlier versions stored the whole database as a JSON string in the EEPROM
+        // It is copied to the store once, the EEPROM is not written any more.
+        void migrateEeprom() {
+            if (!EEPROM.begin(EEPROM_SIZE)) {
+                return;
+            }
+
+            String data = EEPROM.readString(0);
+            EEPROM.end();
+            if (data.length() == 0 || deserializeJson(jsonData, data)) {
+                jsonData.clear();
+                return;
+            }
+
+            rlog -> log(log_prefix, "Migrate the EEPROM data to the store.");
+            loaded = true;
+            save();
+        }
+
+        // Decode the JSON document into the typed config
+        void decodeConfig(Config &decoded) {
+            copyValue(DB_WIFI_NAME, decoded.ssid, sizeof(decoded.ssid));
+            copyValue(DB_WIFI_PASSWORD, decoded.password, sizeof(decoded.password));
+            copyValue(DB_MQTT_SERVER, decoded.mqttServer, sizeof(decoded.mqttServer));
+            copyValue(DB_MQTT_USER, decoded.mqttUser, sizeof(decoded.mqttUser));
+            copyValue(DB_MQTT_PW, decoded.mqttPassword, sizeof(decoded.mqttPassword));
+            copyValue(DB_MQTT_TOPIC_PREFIX, decoded.mqttPrefix, sizeof(decoded.mqttPrefix));
+            decoded.mqttPort = readInt(DB_MQTT_PORT, MQTT_DEFAULT_PORT);
+            decoded.rebootTimeout = readInt(DB_REBOOT_TIMEOUT, 0);
+            decoded.detailed = readInt(DB_DETAILED_REPORT, 0) > 0;
+            decoded.telemetryInterval = readInt(DB_TELEMETRY_INTERVAL, TELEMETRY_INTERVAL);
+        }
+
+        void copyValue(const char* property, char* target, size_t size) {
+            const JsonDocument &document = jsonData;
+            const char* value = document[property] | "";
+            strlcpy(target, value, size);
+        }
+
+        // Values are stored as strings, but numbers are accepted too
+        int readInt(const char* property, int defaultValue) {
+            const JsonDocument &document = jsonData;
+            JsonVariantConst value = document[property];
+            if (value.is<int>()) {
+                return value.as<int>();
+            }
+
+            const char* text = value.as<const char*>();
+            if (text == NULL || *text == '\0') {
+                return defaultValue;
+            }
+
+            char* end;
+            long result = strtol(text, &end, 10);
+            // Decimal part is ignored
+            if (*end != '\0' && *end != '.') {
+                return defaultValue;
             }
-            return true;
+            return result;
         }
 
 };
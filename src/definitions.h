@@ -7,7 +7,7 @@
 // What is this board for? Bed sensor? Relay? Give any kind of name here which will apeear on the web interface
 #define APP_NAME "Dice"
 #define LED_BUILTIN 2
-#define EEPROM_SIZE 1024
+#define EEPROM_SIZE 1024 // Legacy database, it is only read once to migrate it
 
 // Business values
 #define LED_STRIP_PIN 16 // Dice uses WS2812B ledstrip to show light and effects. This pin which the LED strip connected to.
@@ -15,8 +15,19 @@
 // Software settings
 #define SERVER_PORT 80
 #define MQTT_MAX_TRY 10 // give the connect up after this amount of tries
+#define MQTT_MAX_PAYLOAD_SIZE 1024 // Larger incoming messages are dropped
+#define MQTT_RETRY_MIN 1000 // First retry delay after a failed or lost connection (ms)
+#define MQTT_RETRY_MAX 60000 // The retry delay is doubled up to this (ms)
+#define MQTT_CONNECT_CORE 0 // The blocking connect runs in a task on the radio core
+#define MQTT_CONNECT_STACK_SIZE 4096
+#define MQTT_QUEUE_SIZE 8 // Outgoing messages which wait for the loop (or for the connection)
+#define MQTT_QUEUE_TOPIC_SIZE 48
+#define MQTT_QUEUE_PAYLOAD_SIZE 384
+#define MQTT_PUBLISH_BUDGET 8 // Max number of the published messages in one loop pass
+#define MQTT_DEFAULT_PORT 1883
 #define MQTT_TOPIC "/dice"
 #define MQTT_IN_POSTFIX "/in"
+#define MQTT_BINARY_POSTFIX "/bin" // Binary commands arrive on /dice/in/bin
 #define MQTT_STATUS_ON "{\"status\": \"on\"}"
 #define MQTT_STATUS_OFF "{\"status\": \"off\"}"
 
@@ -29,8 +40,46 @@
 #define PROPERTY_NUMBER "number"
 #define PROPERTY_BRIGHTNESS "brightness"
 
+// Binary command frame
+#define BINARY_COMMAND_MAGIC 0xDC
+#define BINARY_COMMAND_VERSION 1
+#define BINARY_COMMAND_LENGTH 13
+
 // Brightness control is skipped under this animation speed
 #define BRIGHTNESS_CONTROL_TIME_LIMIT 400
+// The LED strip is refreshed only on change, but at least once in this interval (ms, 0 = only on change)
+#define LED_REFRESH_INTERVAL 1000
+
+// Dice render task
+#define DICE_RENDER_CORE 1 // App core, the radio stacks run on the other one
+#define DICE_RENDER_PRIORITY 2 // Higher than the Arduino loop task, so network handling cannot delay a frame
+#define DICE_RENDER_STACK_SIZE 4096
+#define DICE_TARGET_FPS 100
+#define DICE_FRAME_POLICY FrameScheduler::drop // What to do with the missed frames: FrameScheduler::drop or FrameScheduler::catchUp
+#define DICE_FADE_PERIOD 20 // Fade up step (ms)
+#define DICE_COMMAND_QUEUE_SIZE 8 // Must be a power of two
+#define DICE_JITTER_REPORT_INTERVAL 60000 // Log the frame timing in this interval (ms, 0 = never)
+#define DICE_STATE_TOPIC "state" // Retained state of the dice: /dice/state
+#define DICE_STATE_MIN_INTERVAL 500 // The state is published at most once in this interval (ms)
+#define DICE_STATE_BUFFER_SIZE 160
+#define DICE_SNAPSHOT_MAGIC 0x44534E50 // "DSNP"
+#define DICE_SNAPSHOT_NAMESPACE "dicestate"
+#define DICE_SNAPSHOT_KEY "state"
+#define DICE_SNAPSHOT_DELAY 10000 // The state is written to the flash after it has not changed for this time (ms)
+
+// Command ingress, commands are merged within one frame period and rate limited (token bucket)
+#define INGRESS_FLUSH_PERIOD (1000 / DICE_TARGET_FPS) // ms
+#define INGRESS_RATE 20 // Commands per second
+#define INGRESS_BURST 5 // Commands which can be passed at once after a quiet period
+
+// Telemetry of the runtime counters: /dice/telemetry
+#define TELEMETRY_TOPIC "telemetry"
+#define TELEMETRY_INTERVAL 60 // Default report interval (s), it can be changed with the telemetry property (0 = disabled)
+#define TELEMETRY_BUFFER_SIZE 360 // Must be smaller than MQTT_QUEUE_PAYLOAD_SIZE
+#define BOOT_TIMELINE_BUFFER_SIZE 160
+#define BOOT_TIMELINE_LOG_TIMEOUT 60000 // The boot timeline is logged when it is complete or after this time (ms)
+#define METRICS_BUFFER_SIZE 512 // Chunk of the /metrics response
+#define WEB_ASSET_CHUNK_SIZE 1024 // Web assets are written to the client in chunks of this size
 
 
 // Network
@@ -58,3 +107,26 @@
 #define DB_VERSION "version"
 #define DB_DETAILED_REPORT "detailed"
 #define DB_REBOOT_TIMEOUT "reboot"
+#define DB_TELEMETRY_INTERVAL "telemetry"
+#define DB_NAMESPACE BOARD_NAME // NVS namespace of the database
+#define DB_KEY_LIST "_keys" // Record of the active record names
+#define DB_KEY_SEPARATOR ','
+#define DB_KEY_GENERATION_SEPARATOR ';' // The key list starts with its generation: <generation>;<record>,<record>
+#define DB_KEY_SLOT_SUFFIX '~' // Name of the second record slot of a property: <name>~
+#define DB_KEY_MAX_LENGTH 14 // Limit of NVS (15) minus the slot suffix
+#define DB_WRITE_DELAY 2000 // Changes are committed after this quiet period (ms)
+#define DB_WRITE_MAX_DELAY 10000 // Continuous changes are committed at least this often (ms)
+
+// Size of the text fields of the typed config (with the closing zero)
+#define CONFIG_SSID_SIZE 33
+#define CONFIG_PASSWORD_SIZE 65
+#define CONFIG_HOST_SIZE 65
+#define CONFIG_USER_SIZE 33
+#define CONFIG_PREFIX_SIZE 33
+
+// Binary image of the typed config
+#define CONFIG_IMAGE_MAGIC 0x47464344 // "DCFG"
+#define CONFIG_SCHEMA_VERSION 1 // Increment when the Config struct changes, an image of an other version is rebuilt from the records
+#define CONFIG_IMAGE_MAX_PAYLOAD 512
+#define CONFIG_BANK_A "cfg_a"
+#define CONFIG_BANK_B "cfg_b"
@@ -0,0 +1,97 @@
+#ifndef INGRESS
+#define INGRESS
+
+#include "definitions.h"
+#include <Callback.h>
+#include "log.cpp"
+#include "command.cpp"
+#include "metrics.cpp"
+
+// Ingress stage of the dice commands (MQTT, Bluetooth)
+// Commands which arrive within one frame period are merged into one (the latest value of every property wins),
+// and the merged commands are passed on with a token bucket rate limit. A flood of commands from a slider
+// or a script therefore ends up in a few updates instead of a queue of full command executions.
+class CommandIngress {
+
+    Log* rlog;
+    String log_prefix = "[INGRESS] ";
+    Signal<DiceCommand>* diceCommandReady;
+
+    DiceCommand pending = {};
+    unsigned long lastFlush = 0;
+
+    // Token bucket, in 1/1000 tokens
+    uint32_t tokens = INGRESS_BURST * 1000;
+    unsigned long lastRefill = 0;
+
+    public:
+        CommandIngress(Log &log) {
+            this -> rlog = &log;
+        }
+
+        void setup(Signal<DiceCommand> &diceCommandReady) {
+            this -> diceCommandReady = &diceCommandReady;
+        }
+
+        void loop() {
+            if (pending.fields == 0 || millis() - lastFlush < INGRESS_FLUSH_PERIOD) {
+                return;
+            }
+
+            refill();
+            if (tokens < 1000) {
+                Metrics::increment(METRIC_COMMANDS_LIMITED);
+                return;
+            }
+            tokens -= 1000;
+
+            lastFlush = millis();
+            DiceCommand command = pending;
+            pending = {};
+            this -> diceCommandReady -> fire(command);
+        }
+
+        void submit(DiceCommand command) {
+            Metrics::increment(METRIC_COMMANDS_RECEIVED);
+
+            if (pending.fields != 0) {
+                Metrics::increment(METRIC_COMMANDS_MERGED);
+                if ((pending.fields & command.fields & DICE_FIELD_COMMAND) != 0) {
+                    Metrics::increment(METRIC_COMMANDS_DROPPED);
+                }
+            }
+
+            if (command.fields & DICE_FIELD_COMMAND) {
+                pending.command = command.command;
+            }
+            if (command.fields & DICE_FIELD_SPEED) {
+                pending.speed = command.speed;
+            }
+            if (command.fields & DICE_FIELD_COUNT) {
+                pending.count = command.count;
+            }
+            if (command.fields & DICE_FIELD_INFINITY) {
+                pending.infinity = command.infinity;
+            }
+            if (command.fields & DICE_FIELD_COLOR) {
+                pending.color = command.color;
+            }
+            if (command.fields & DICE_FIELD_NUMBER) {
+                pending.number = command.number;
+            }
+            if (command.fields & DICE_FIELD_BRIGHTNESS) {
+                pending.brightness = command.brightness;
+            }
+            pending.fields |= command.fields;
+        }
+
+    private:
+        void refill() {
+            unsigned long now = millis();
+            uint64_t refilled = tokens + (uint64_t) (now - lastRefill) * INGRESS_RATE;
+            tokens = refilled > INGRESS_BURST * 1000 ? INGRESS_BURST * 1000 : refilled;
+            lastRefill = now;
+        }
+};
+
+#endif
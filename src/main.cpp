@@ -16,6 +16,11 @@
 #include "webserver.cpp"
 #include "mqtt.cpp"
 #include "bluetooth.cpp"
+#include "router.cpp"
+#include "ingress.cpp"
+#include "telemetry.cpp"
+#include "metrics.cpp"
+#include "boot.cpp"
 
 Log rlog;
 Led led(rlog);
@@ -24,6 +29,9 @@ Wifi wifi(rlog);
 Webserver webserver(rlog);
 BlueTooth blueTooth(rlog);
 Mqtt mqtt(rlog);
+CommandRouter router(rlog);
+CommandIngress ingress(rlog);
+Telemetry telemetry(rlog);
 
 ////////////////////////////////////////////////////////////
 ///////////// MODULES //////////////////////////////////////
@@ -36,12 +44,50 @@ Dice module(rlog);
 // https://github.com/tomstewart89/Callback
 Signal<boolean> wifiStatusChanged;
 Signal<int> errorCodeChanged;
-Signal<String> messageArrived;
+Signal<RawMessage> messageArrived;
+Signal<JsonObject> configCommandArrived;
+Signal<DiceCommand> diceCommandArrived;
+Signal<DiceCommand> diceCommandReady;
 Signal<MQTTMessage> mqttMessageSend;
+Signal<uint32_t> configChanged;
 
 String log_prefix = "[MAIN] ";
 
-int rebootAfterHours = 0;
+// The radios are started in the loop one by one, so the LEDs and the restored state are shown at once
+enum BootStage {
+  STAGE_WIFI,
+  STAGE_WEBSERVER,
+  STAGE_BLUETOOTH,
+  STAGE_DONE
+};
+int bootStage = STAGE_WIFI;
+bool bootTimelineLogged = false;
+
+void startNextStage() {
+  switch (bootStage) {
+    case STAGE_WIFI:
+      wifi.setup(database, wifiStatusChanged, errorCodeChanged);
+      wifi.connectWifi();
+      break;
+    case STAGE_WEBSERVER:
+      // Must be after Wifi setup
+      webserver.setup(database);
+      break;
+    case STAGE_BLUETOOTH:
+      blueTooth.setup(messageArrived);
+      break;
+  }
+  bootStage++;
+}
+
+void logBootTimeline() {
+  if (!bootTimelineLogged && (BootTimeline::isComplete() || millis() > BOOT_TIMELINE_LOG_TIMEOUT)) {
+    char timeline[BOOT_TIMELINE_BUFFER_SIZE];
+    BootTimeline::serialize(timeline, sizeof(timeline));
+    rlog.log(log_prefix, (String) "Boot timeline (ms): " + timeline);
+    bootTimelineLogged = true;
+  }
+}
 
 void setup() {
   // callback(s)
@@ -55,50 +101,78 @@ void setup() {
   errorCodeChanged.attach(errorCodeChangedForLed);
 
   // MQTT and Blutooth command handling
-  // Arrive  
-  MethodSlot<Database, String> messageSendForDatabase(&database,&Database::receiveCommand);
-  messageArrived.attach(messageSendForDatabase);
+  // Arrive, every message is parsed once by the router
+  MethodSlot<CommandRouter, RawMessage> messageSendForRouter(&router,&CommandRouter::route);
+  messageArrived.attach(messageSendForRouter);
+
+  // Parsed commands go only to their owner
+  MethodSlot<Database, JsonObject> configCommandForDatabase(&database,&Database::receiveConfig);
+  configCommandArrived.attach(configCommandForDatabase);
 
-  MethodSlot<Dice, String> messageSendForModule(&module,&Dice::receiveCommand);
-  messageArrived.attach(messageSendForModule);
+  // Dice commands from the router are merged and rate limited by the ingress
+  MethodSlot<CommandIngress, DiceCommand> diceCommandForIngress(&ingress,&CommandIngress::submit);
+  diceCommandArrived.attach(diceCommandForIngress);
+
+  MethodSlot<Dice, DiceCommand> diceCommandForModule(&module,&Dice::receiveDiceCommand);
+  diceCommandReady.attach(diceCommandForModule);
+
+  // Config is changed, the modules apply it without a reboot
+  MethodSlot<Wifi, uint32_t> configChangedForWifi(&wifi,&Wifi::receiveConfigChange);
+  configChanged.attach(configChangedForWifi);
+  MethodSlot<Mqtt, uint32_t> configChangedForMqtt(&mqtt,&Mqtt::receiveConfigChange);
+  configChanged.attach(configChangedForMqtt);
+  MethodSlot<Telemetry, uint32_t> configChangedForTelemetry(&telemetry,&Telemetry::receiveConfigChange);
+  configChanged.attach(configChangedForTelemetry);
 
   // Send
   MethodSlot<Mqtt, MQTTMessage> mqttMessageSendForMqtt(&mqtt,&Mqtt::sendMqttMessage);
   mqttMessageSend.attach(mqttMessageSendForMqtt);
 
   rlog.setup();
-  led.setup();
-  database.setup();
-  wifi.setup(database, wifiStatusChanged, errorCodeChanged);
-  blueTooth.setup(messageArrived); 
-
+  // LEDs first, the dice shows its last state before the network is started
   module.setup(mqttMessageSend);
-  
-
-  // Must be after Wifi setup
-  webserver.setup(database);
-  
+  led.setup();
+  router.setup(configCommandArrived, diceCommandArrived);
+  ingress.setup(diceCommandReady);
+  database.setup(configChanged);
   mqtt.setup(database, errorCodeChanged, messageArrived);
-  // Connect to WiFi
-  wifi.connectWifi();
-
-  // Workaround for stuc after some days
-  rebootAfterHours = database.getValueAsInt(DB_REBOOT_TIMEOUT);
+  telemetry.setup(database, mqttMessageSend);
+  // Wifi, webserver and Bluetooth are started by the loop
 }
 
 void loop() {  
+  unsigned long loopStart = micros();
+
+  if (bootStage != STAGE_DONE) {
+    startNextStage();
+  }
+
   // Object loops
   rlog.loop();
   led.loop();
   database.loop();
-  wifi.loop();
-  webserver.loop();
+  if (bootStage > STAGE_WIFI) {
+    wifi.loop();
+  }
+  if (bootStage > STAGE_WEBSERVER) {
+    webserver.loop();
+  }
   mqtt.loop();
-  blueTooth.loop();
+  if (bootStage > STAGE_BLUETOOTH) {
+    blueTooth.loop();
+  }
+  ingress.loop();
 
   module.loop();
+  telemetry.loop();
+  logBootTimeline();
+
+  Metrics::observeLoop(micros() - loopStart);
 
+  // Workaround for stuc after some days
+  int rebootAfterHours = database.getConfig().rebootTimeout;
   if ((rebootAfterHours > 0) && (millis() > (rebootAfterHours * 60 * 60 * 1000))) {
+    database.flush();
     ESP.restart();
   }
 }
\ No newline at end of file
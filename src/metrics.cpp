@@ -0,0 +1,194 @@
+#ifndef METRICS
+#define METRICS
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_system.h>
+
+// Counters of the runtime, every module increments them
+enum Metric : uint8_t {
+    METRIC_FRAMES, // Rendered dice frames
+    METRIC_LED_SHOWS, // FastLED.show() calls
+    METRIC_COMMANDS, // Routed incoming commands
+    METRIC_PARSE_ERRORS, // Commands which could not be parsed
+    METRIC_COMMANDS_RECEIVED, // Dice commands submitted to the ingress
+    METRIC_COMMANDS_MERGED, // Dice commands merged into a pending one
+    METRIC_COMMANDS_DROPPED, // Effects replaced by a newer one before they were applied
+    METRIC_COMMANDS_LIMITED, // Ingress flushes delayed by the rate limit
+    METRIC_MQTT_MESSAGES_IN,
+    METRIC_MQTT_MESSAGES_OUT,
+    METRIC_MQTT_RECONNECTS,
+    METRIC_MQTT_PUBLISH_FAILURES,
+    METRIC_MQTT_QUEUE_DROPS, // Outgoing messages dropped by the full publish queue
+    METRIC_MQTT_QUEUE_MERGED, // Retained messages which replaced a queued one
+    METRIC_WIFI_DISCONNECTS,
+    METRIC_HTTP_REQUESTS,
+    METRIC_DB_COMMITS, // Flash commits of the database
+    METRIC_DB_COMMITS_AVOIDED, // Changes which were merged into a pending commit
+    METRIC_DB_RECORD_WRITES, // NVS writes and removes of the database commits (flash wear)
+    METRIC_COUNT
+};
+
+// Names in the telemetry and metrics documents, in the order of Metric
+static const char* const METRIC_NAMES[METRIC_COUNT] = {
+    "frames",
+    "led_shows",
+    "commands",
+    "parse_errors",
+    "commands_received",
+    "commands_merged",
+    "commands_dropped",
+    "commands_limited",
+    "mqtt_messages_in",
+    "mqtt_messages_out",
+    "mqtt_reconnects",
+    "mqtt_publish_failures",
+    "mqtt_queue_drops",
+    "mqtt_queue_merged",
+    "wifi_disconnects",
+    "http_requests",
+    "db_commits",
+    "db_commits_avoided",
+    "db_record_writes"
+};
+
+// Actual values, they are set by their module
+enum Gauge : uint8_t {
+    GAUGE_MQTT_QUEUE_DEPTH, // Messages in the publish queue
+    GAUGE_MQTT_QUEUE_HIGH_WATER, // Most messages in the publish queue since the start
+    GAUGE_COUNT
+};
+
+static const char* const GAUGE_NAMES[GAUGE_COUNT] = {
+    "mqtt_queue_depth",
+    "mqtt_queue_high_water"
+};
+
+// Duration histograms
+enum Histogram : uint8_t {
+    HISTOGRAM_LOOP, // Arduino loop
+    HISTOGRAM_LED_SHOW, // FastLED.show()
+    HISTOGRAM_COUNT
+};
+
+static const char* const HISTOGRAM_NAMES[HISTOGRAM_COUNT] = {
+    "loop_duration",
+    "led_show_duration"
+};
+
+// Upper bounds of the histogram buckets (us), the last bucket is +Inf
+static constexpr uint32_t HISTOGRAM_BOUNDS[] = {100, 250, 500, 1000, 2500, 5000, 10000, 50000, 100000};
+#define HISTOGRAM_BOUND_COUNT (sizeof(HISTOGRAM_BOUNDS) / sizeof(HISTOGRAM_BOUNDS[0]))
+
+// Names of esp_reset_reason_t
+static const char* const RESET_REASONS[] = {
+    "unknown", "poweron", "external", "software", "panic", "interrupt_watchdog",
+    "task_watchdog", "watchdog", "deepsleep", "brownout", "sdio"
+};
+
+// Lightweight counter registry
+// Counters are fixed atomics, so they can be incremented from any task without allocation or locking.
+class Metrics {
+
+    std::atomic<uint32_t> counters[METRIC_COUNT];
+    std::atomic<uint32_t> gauges[GAUGE_COUNT];
+
+    // Duration of the Arduino loop since the last read (us)
+    std::atomic<uint32_t> loopCount;
+    std::atomic<uint32_t> loopSum;
+    std::atomic<uint32_t> loopMax;
+
+    // Histograms are updated from both cores, a bucket, the sum and the count change together
+    portMUX_TYPE histogramLock = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t buckets[HISTOGRAM_COUNT][HISTOGRAM_BOUND_COUNT + 1];
+    uint64_t sums[HISTOGRAM_COUNT];
+    uint32_t counts[HISTOGRAM_COUNT];
+
+    Metrics() {
+        for (int i = 0; i < METRIC_COUNT; i++) {
+            counters[i] = 0;
+        }
+        for (int i = 0; i < GAUGE_COUNT; i++) {
+            gauges[i] = 0;
+        }
+        loopCount = 0;
+        loopSum = 0;
+        loopMax = 0;
+        memset(buckets, 0, sizeof(buckets));
+        memset(sums, 0, sizeof(sums));
+        memset(counts, 0, sizeof(counts));
+    }
+
+    static Metrics& instance() {
+        static Metrics metrics;
+        return metrics;
+    }
+
+    public:
+        static void increment(Metric metric, uint32_t value = 1) {
+            instance().counters[metric].fetch_add(value, std::memory_order_relaxed);
+        }
+
+        static uint32_t get(Metric metric) {
+            return instance().counters[metric].load(std::memory_order_relaxed);
+        }
+
+        static void set(Gauge gauge, uint32_t value) {
+            instance().gauges[gauge].store(value, std::memory_order_relaxed);
+        }
+
+        static uint32_t get(Gauge gauge) {
+            return instance().gauges[gauge].load(std::memory_order_relaxed);
+        }
+
+        // Add a duration (us) to a histogram
+        static void observe(Histogram histogram, uint32_t duration) {
+            Metrics &metrics = instance();
+            size_t bucket = 0;
+            while (bucket < HISTOGRAM_BOUND_COUNT && duration > HISTOGRAM_BOUNDS[bucket]) {
+                bucket++;
+            }
+            portENTER_CRITICAL(&metrics.histogramLock);
+            metrics.buckets[histogram][bucket]++;
+            metrics.sums[histogram] += duration;
+            metrics.counts[histogram]++;
+            portEXIT_CRITICAL(&metrics.histogramLock);
+        }
+
+        // Consistent copy of a histogram
+        // buckets must have HISTOGRAM_BOUND_COUNT + 1 items, they are not cumulative
+        static void readHistogram(Histogram histogram, uint32_t* buckets, uint64_t &sum, uint32_t &count) {
+            Metrics &metrics = instance();
+            portENTER_CRITICAL(&metrics.histogramLock);
+            memcpy(buckets, metrics.buckets[histogram], sizeof(metrics.buckets[histogram]));
+            sum = metrics.sums[histogram];
+            count = metrics.counts[histogram];
+            portEXIT_CRITICAL(&metrics.histogramLock);
+        }
+
+        static const char* getResetReason() {
+            size_t reason = esp_reset_reason();
+            return reason < sizeof(RESET_REASONS) / sizeof(RESET_REASONS[0]) ? RESET_REASONS[reason] : RESET_REASONS[0];
+        }
+
+        static void observeLoop(uint32_t duration) {
+            observe(HISTOGRAM_LOOP, duration);
+            Metrics &metrics = instance();
+            metrics.loopCount.fetch_add(1, std::memory_order_relaxed);
+            metrics.loopSum.fetch_add(duration, std::memory_order_relaxed);
+            if (duration > metrics.loopMax.load(std::memory_order_relaxed)) {
+                metrics.loopMax.store(duration, std::memory_order_relaxed);
+            }
+        }
+
+        // Average and maximum loop duration since the last call (us)
+        static void takeLoopStats(uint32_t &average, uint32_t &maximum) {
+            Metrics &metrics = instance();
+            uint32_t count = metrics.loopCount.exchange(0);
+            uint32_t sum = metrics.loopSum.exchange(0);
+            maximum = metrics.loopMax.exchange(0);
+            average = count > 0 ? sum / count : 0;
+        }
+};
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef ANIMATION
+#define ANIMATION
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "command.cpp"
+
+// Data driven animation engine of the dice
+// Every effect is a row in a table. One interpreter evaluates all of them,
+// so a new effect is a new row and not a new code path.
+
+// LED masks of the dice faces. Bit n means the n. LED of the strip.
+// Every face has its own LEDs on the strip: 1 -> 0, 2 -> 1-2, 3 -> 3-5, 4 -> 6-9, 5 -> 10-14, 6 -> 15-20
+// Index 0 is an empty face (all LEDs are off)
+static constexpr uint32_t DICE_FACE_MASKS[7] = {
+    0x000000,
+    0x000001,
+    0x000006,
+    0x000038,
+    0x0003C0,
+    0x007C00,
+    0x1F8000
+};
+#define DICE_ALL_LEDS_MASK 0x1FFFFF
+
+// Next and previous face (index is the actual face, 0 is treated as 1)
+static constexpr uint8_t DICE_NEXT_FACE[7] = {2, 2, 3, 4, 5, 6, 1};
+static constexpr uint8_t DICE_PREVIOUS_FACE[7] = {6, 6, 1, 2, 3, 4, 5};
+
+// Color of a keyframe which means the actual color of the dice
+#define KEYFRAME_CURRENT_COLOR 0xFFFFFFFF
+
+// How the face changes in every step
+enum FaceStep : uint8_t {
+    FACE_KEYFRAMES, // No face, the keyframes of the effect are shown one after the other
+    FACE_CURRENT, // Show the actual face
+    FACE_RANDOM, // Show a random face, the actual face is not changed
+    FACE_RANDOM_NEW, // Change to a random face which is different from the actual one
+    FACE_NEXT, // Count up
+    FACE_PREVIOUS // Count down
+};
+
+// When the effect stops
+enum Termination : uint8_t {
+    END_AFTER_COUNT, // After the count of the steps (unless infinity is set)
+    END_NEVER // Always infinite
+};
+
+struct DiceKeyframe {
+    uint32_t mask; // LEDs to light
+    uint32_t color; // 0xRRGGBB or KEYFRAME_CURRENT_COLOR
+};
+
+struct DiceEffect {
+    FaceStep faceStep;
+    const DiceKeyframe* keyframes; // Used by FACE_KEYFRAMES only
+    uint8_t keyframeCount;
+    uint16_t easing; // Step duration is multiplied by this after every step (Q8 fixed point, 256 = constant speed)
+    uint16_t minSpeed; // Shortest step duration (ms)
+    uint16_t maxSpeed; // Longest step duration (ms, 0 = no limit)
+    Termination termination;
+};
+
+static const DiceKeyframe KEYFRAMES_SINGLE_COLOR[] = {
+    {DICE_ALL_LEDS_MASK, KEYFRAME_CURRENT_COLOR}
+};
+
+static const DiceKeyframe KEYFRAMES_ERROR[] = {
+    {DICE_ALL_LEDS_MASK, 0xFF0000},
+    {DICE_ALL_LEDS_MASK, 0x000000}
+};
+
+// The index is the command number in the API (see COMMAND_ROUTES)
+static const DiceEffect DICE_EFFECTS[] = {
+    // face step        keyframes               count  easing  min  max   termination
+    {FACE_CURRENT,      NULL,                   0,     256,    0,   0,    END_AFTER_COUNT}, // showNumber
+    {FACE_KEYFRAMES,    KEYFRAMES_SINGLE_COLOR, 1,     256,    0,   0,    END_AFTER_COUNT}, // singleColor
+    {FACE_RANDOM,       NULL,                   0,     256,    0,   0,    END_AFTER_COUNT}, // rollTheDice
+    {FACE_RANDOM_NEW,   NULL,                   0,     179,    100, 0,    END_AFTER_COUNT}, // rollTheDiceAnimatedToSpinUp, x0.7
+    {FACE_RANDOM_NEW,   NULL,                   0,     269,    50,  3000, END_AFTER_COUNT}, // rollTheDiceAnimatedToSlowDown, x1.05
+    {FACE_NEXT,         NULL,                   0,     256,    0,   0,    END_AFTER_COUNT}, // orderRun
+    {FACE_PREVIOUS,     NULL,                   0,     256,    0,   0,    END_AFTER_COUNT}, // reverseOrderRun
+    {FACE_KEYFRAMES,    KEYFRAMES_ERROR,        2,     256,    300, 300,  END_NEVER} // error
+};
+#define DICE_EFFECT_COUNT (sizeof(DICE_EFFECTS) / sizeof(DICE_EFFECTS[0]))
+#define DICE_EFFECT_ERROR DICE_COMMAND_ERROR
+static_assert(DICE_EFFECT_COUNT == DICE_COMMAND_COUNT, "Every dice command needs an effect");
+
+// Interpreter of the effect table
+class Animation {
+
+    const DiceEffect* effect = &DICE_EFFECTS[1];
+    uint8_t stepIndex = 0;
+
+    public:
+        // Variables which can be modified from outside
+        uint32_t speed = 200; // Duration of a step (ms)
+        int count = 1;
+        bool infinity = false;
+        uint8_t number = 1; // Always shows the real number (not an array style)
+        CRGB color = CRGB(0xFF8000);
+
+        void start(uint8_t effectId) {
+            if (effectId >= DICE_EFFECT_COUNT) {
+                effectId = DICE_EFFECT_ERROR;
+            }
+            effect = &DICE_EFFECTS[effectId];
+            stepIndex = 0;
+            clampSpeed();
+        }
+
+        uint8_t getEffectId() {
+            return effect - DICE_EFFECTS;
+        }
+
+        bool isRunning() {
+            return count > 0 || infinity || effect -> termination == END_NEVER;
+        }
+
+        // Evaluate the next step of the effect
+        // mask and color are set to the frame which should be shown
+        void step(uint32_t &mask, CRGB &frameColor) {
+            if (number < 1 || number > 6) {
+                number = constrain(number, 1, 6);
+            }
+
+            uint8_t face = number;
+            switch (effect -> faceStep) {
+                case FACE_KEYFRAMES: {
+                    const DiceKeyframe &keyframe = effect -> keyframes[stepIndex];
+                    stepIndex = (stepIndex + 1) % effect -> keyframeCount;
+                    mask = keyframe.mask;
+                    frameColor = keyframe.color == KEYFRAME_CURRENT_COLOR ? color : CRGB(keyframe.color);
+                    break;
+                }
+                case FACE_RANDOM:
+                    face = random(1, 7);
+                    break;
+                case FACE_RANDOM_NEW:
+                    // Shift with 1-5, so it is always a different face
+                    face = number = (number + random(1, 6) - 1) % 6 + 1;
+                    break;
+                case FACE_NEXT:
+                    face = number = DICE_NEXT_FACE[number];
+                    break;
+                case FACE_PREVIOUS:
+                    face = number = DICE_PREVIOUS_FACE[number];
+                    break;
+                default:
+                    break;
+            }
+
+            if (effect -> faceStep != FACE_KEYFRAMES) {
+                mask = DICE_FACE_MASKS[face];
+                frameColor = color;
+            }
+
+            speed = (speed * effect -> easing) >> 8;
+            clampSpeed();
+
+            // Reduce the animation count after animation
+            if (!infinity && effect -> termination == END_AFTER_COUNT) {
+                count--;
+            }
+        }
+
+    private:
+        void clampSpeed() {
+            if (speed < effect -> minSpeed) {
+                speed = effect -> minSpeed;
+            }
+            if (effect -> maxSpeed > 0 && speed > effect -> maxSpeed) {
+                speed = effect -> maxSpeed;
+            }
+        }
+};
+
+#endif
@@ -6,8 +6,17 @@
 #include "definitions.h"
 #include "log.cpp"
 #include "mqtt.cpp"
+#include "command.cpp"
+#include "spscqueue.cpp"
+#include "ledframe.cpp"
+#include "framescheduler.cpp"
+#include "animation.cpp"
+#include "dicesnapshot.cpp"
+#include "metrics.cpp"
+#include "boot.cpp"
 #include <FastLED.h>
 #include <LinkedList.h>
+#include <esp_timer.h>
 
 // Number of the dice's points
 #define NUM_LEDS 21
@@ -15,6 +24,26 @@
 #define LED_TYPE            WS2812B
 #define COLOR_ORDER         GRB
 
+// Fade up of the brightness (Q8 fixed point)
+#define FADE_START 307 // 1.2
+#define FADE_FACTOR 307 // x1.2 in every fade step
+
+// State of the dice which is published on the state topic
+struct DiceState {
+    uint8_t command;
+    uint8_t number;
+    uint32_t color; // 0xRRGGBB
+    uint8_t brightness;
+    int count; // Remaining animation steps
+    bool infinity;
+    bool running;
+
+    bool equals(const DiceState &other) const {
+        return command == other.command && number == other.number && color == other.color && brightness == other.brightness
+            && count == other.count && infinity == other.infinity && running == other.running;
+    }
+};
+
 class Dice {
 
     Log* rlog;
@@ -23,48 +52,52 @@ class Dice {
 
     static const uint8_t DATA_PIN = LED_STRIP_PIN;
 
-    // Create array for the dice points
-    CRGB leds[NUM_LEDS];    
-
-    // Variables which can be modified from outside    
-    float animationSpeed = 200.0;
-    int animationCount = 1;
-    bool infinityAnimation = false;
-    String currentColor = "#FF8000";
-
-    // Command set which is available from outside
-    enum Command {
-        showNumber, // Show a number on a dice 1-6
-        singleColor, // set all pixels to actual color
-        rollTheDice, // display a random number on the dice
-        rollTheDiceAnimatedToSpinUp, // random dice numbers, spin up and finally stop at a random number
-        rollTheDiceAnimatedToSlowDown, // random dice numbers, slow down and finally stop at a random number
-        orderRun, // count up the dice numbers
-        reverseOrderRun, // count down the dice numbers
-        error // in case of error, show some noticable light
-    };
-
-    Command commandConvert(const String& str)
-    {
-        if(str == "showNumber") { return showNumber; }
-        if(str == "singleColor") { return singleColor; }
-        if(str == "rollTheDice") { return rollTheDice; }
-        if(str == "rollTheDiceAnimatedToSpinUp") { return rollTheDiceAnimatedToSpinUp; }
-        if(str == "rollTheDiceAnimatedToSlowDown") { return rollTheDiceAnimatedToSlowDown; }
-        if(str == "orderRun") { return orderRun; }
-        if(str == "reverseOrderRun") { return reverseOrderRun; }
-
-        // else
-        return error;
-    }
+    // Frame of the dice points, it is pushed to the strip only on change
+    LedFrame<NUM_LEDS> frame;
+
+    // Commands from the network (Arduino loop) to the render task
+    SpscQueue<DiceCommand, DICE_COMMAND_QUEUE_SIZE> commandQueue;
+    TaskHandle_t renderTaskHandle = NULL;
+    FrameScheduler scheduler;
+
+    // Actual effect and its properties, which can be modified from outside
+    Animation animation;
 
     // Helper variables
-    Command currentCommand = singleColor;
-    int currentDiceNumber = 1; // Always shows the real number (not an array style)
-    int lastAnimationTime = 0; // Handle the delay with this (avoid delay() function)
-    int lastFadeTime = 0; // Fade up light animation timer
-    float brightness = 0; //Use this value to "spin up" slow the light (increase brightness during the loop)
-    int ceilBrightness = 255; // This value is for control, the user brightness. The maximum value of amount of light
+    int64_t nextAnimationTime = 0; // Deadline of the next animation step (esp_timer, us)
+    int64_t nextFadeTime = 0; // Deadline of the next fade up step (esp_timer, us)
+    uint32_t brightness = 0; // Use this value to "spin up" slow the light (increase brightness during the loop, Q8 fixed point)
+    uint32_t ceilBrightness = 255; // This value is for control, the user brightness. The maximum value of amount of light
+
+    // Frame timing measurement (render task), in microseconds
+    uint32_t jitterMax = 0;
+    uint64_t jitterSum = 0;
+    uint32_t jitterFrames = 0;
+    // Last finished measurement window, these are read by the Arduino loop
+    volatile uint32_t reportedJitterMax = 0;
+    volatile uint32_t reportedJitterAverage = 0;
+    unsigned long lastJitterReport = 0;
+
+    // State is written by the render task on change and published from the Arduino loop
+    portMUX_TYPE stateLock = portMUX_INITIALIZER_UNLOCKED;
+    DiceState state = {};
+    volatile uint32_t stateVersion = 0;
+    // Publisher side (Arduino loop)
+    uint32_t publishedVersion = 0;
+    DiceState publishedState = {};
+    unsigned long lastStatePublish = 0;
+    char stateBuffer[DICE_STATE_BUFFER_SIZE]; // Serialized state, rebuilt only when the state is changed
+
+    // State which is restored after a reboot
+    // The render task writes the RTC copy on change, the Arduino loop writes the flash copy when the state is stable
+    DiceSnapshotStore snapshotStore;
+    DiceSnapshot sharedSnapshot; // Shared, guarded by stateLock
+    uint32_t lastMask = 0; // Last shown frame (render task)
+    CRGB lastColor = CRGB::Black;
+    DiceSnapshot pendingSnapshot; // Arduino loop
+    DiceSnapshot flashSnapshot;
+    bool snapshotPending = false;
+    unsigned long lastSnapshotChange = 0;
     
     public:
         Dice(Log &rlog) {
@@ -75,301 +108,330 @@ class Dice {
 
             this -> message = &message;
 
-            delay(3000); // 3 second delay for boot recovery, and a moment of silence
-            FastLED.addLeds<LED_TYPE,DATA_PIN,COLOR_ORDER>(leds, NUM_LEDS).setCorrection( TypicalLEDStrip );
+            FastLED.addLeds<LED_TYPE,DATA_PIN,COLOR_ORDER>(frame.getPixels(), NUM_LEDS).setCorrection( TypicalLEDStrip );
             FastLED.setMaxPowerInVoltsAndMilliamps(5, MAX_POWER_MILLIAMPS);
+            frame.setKeepAliveInterval(LED_REFRESH_INTERVAL);
+
+            // The render task is not running yet, the state can be set directly
+            restoreState();
+
+            scheduler.setup(DICE_TARGET_FPS, DICE_FRAME_POLICY);
+
+            // Rendering has its own task, so the network handling in the Arduino loop cannot freeze the animation
+            xTaskCreatePinnedToCore(renderTask, "dice", DICE_RENDER_STACK_SIZE, this, DICE_RENDER_PRIORITY, &renderTaskHandle, DICE_RENDER_CORE);
 
             this -> rlog -> log(log_prefix, "Dice is ready");
             
         }
 
+        // Runs in the Arduino loop, the animation runs in the render task
         void loop() {
-
-            // Fade up light
-            // But if we want to have speed motion, skip the fade up mechanism
-            if (animationSpeed > BRIGHTNESS_CONTROL_TIME_LIMIT) {
-                if (millis() - lastFadeTime > 20) {
-                    if (brightness == 0) {
-                        brightness = 1.2;
-                    }
-
-                    lastFadeTime = millis();
-                    brightness = brightness * 1.2;
-                    if (brightness > ceilBrightness) {
-                        brightness = ceilBrightness;
-                    }
-                }
-            } else {
-                brightness = ceilBrightness;
+            if (DICE_JITTER_REPORT_INTERVAL > 0 && millis() - lastJitterReport > DICE_JITTER_REPORT_INTERVAL) {
+                lastJitterReport = millis();
+                this -> rlog -> log(log_prefix, (String) "Frame jitter (us) max: " + reportedJitterMax + " avg: " + reportedJitterAverage + " missed deadlines: " + scheduler.getMissedDeadlines() + " shows: " + getShowsPerformed() + " skipped: " + getShowsSkipped());
             }
 
-            if ((animationCount > 0 || infinityAnimation) && brightness == 255) {
-                if (millis() - lastAnimationTime > animationSpeed) {                    
-                    lastAnimationTime = millis();
-
-                    // Strip does the animation which is in the command
-                    switch (currentCommand)
-                    {
-                        case showNumber:
-                            setDiceNumber(currentDiceNumber);
-                            break;
-                        case singleColor:
-                            colorizeLedStrip();
-                            break;
-                        case rollTheDice:
-                            rollDice();
-                            break;
-                        case rollTheDiceAnimatedToSpinUp:
-                            rollDiceAnimatedToSpinUp();
-                            break;
-                        case rollTheDiceAnimatedToSlowDown:
-                            rollDiceAnimatedToSlowDown();
-                            break;
-                        case orderRun:
-                            countUp();
-                            setDiceNumber(currentDiceNumber);
-                            break;
-                        case reverseOrderRun:
-                            countDown();
-                            setDiceNumber(currentDiceNumber);
-                            break;
-                        case error:
-                            errorLight();                            
-                            break;
-                        
-                        default:
-                            resetLedStrip();
-                            break;
-                    }
-                    
-                    // Reduce the animation count after animation
-                    if (!infinityAnimation) {
-                        animationCount--;
-                    }
-                    // Need for the fade up to star the animation from "black"
-                    brightness = 0;                   
-                }
-            }
-            
-            FastLED.setBrightness(brightness);
-            FastLED.show();
+            publishState();
+            persistState();
         }
-  
 
-        void receiveCommand(String message) {
+        // Number of the strip updates which were pushed / skipped, because the frame had not changed
+        uint32_t getShowsPerformed() {
+            return frame.getShowsPerformed();
+        }
 
-            StaticJsonDocument<1000> tempJson; 
-            DeserializationError Derror = deserializeJson(tempJson, message);
+        uint32_t getShowsSkipped() {
+            return frame.getShowsSkipped();
+        }
+
+        // Frames which started after the deadline of the next frame (the dropped frames are not counted)
+        uint32_t getMissedDeadlines() {
+            return scheduler.getMissedDeadlines();
+        }
 
-            this -> rlog -> log(log_prefix, "Message reseived: " + message);
+        // Maximum and average difference between the planned and the real frame start in the last second (us)
+        uint32_t getFrameJitterMax() {
+            return reportedJitterMax;
+        }
 
-            if (Derror) {
-                rlog -> log(log_prefix + (String) "DeserializationError: " + Derror.c_str() + " (receiveCommand) " + message);
-                currentCommand = error;
-            } else {
+        uint32_t getFrameJitterAverage() {
+            return reportedJitterAverage;
+        }
 
-                if (tempJson.containsKey(PROPERTY_COMMAND)) {
+        // Pass a decoded command to the render task
+        void receiveDiceCommand(DiceCommand command) {
+            if (command.fields != 0 && !commandQueue.push(command)) {
+                this -> rlog -> log(log_prefix, "Command queue is full, command is dropped.");
+            }
+        }
 
-                    // Try to get a command even if that is a number or string value (both valid)
-                    String c = tempJson[PROPERTY_COMMAND].as<String>();
-                    if (is_number(c)) {
-                        currentCommand = (Command) tempJson[PROPERTY_COMMAND].as<int>();
-                    } else {
-                        currentCommand = commandConvert(c);
-                    }
-                    resetLedStrip();
-                    this -> rlog -> log(log_prefix, "New command: " + tempJson[PROPERTY_COMMAND].as<String>());
-                } else {
-                    this -> rlog -> log(log_prefix, "Command was not valid");
-                }
+    private:
 
-                if (tempJson.containsKey(PROPERTY_SPEED)) {
-                    animationSpeed = tempJson[PROPERTY_SPEED].as<int>();
-                    this -> rlog -> log(log_prefix, "New speed: " + (String) animationSpeed);
-                }
+    static void renderTask(void* parameter) {
+        ((Dice*) parameter) -> renderLoop();
+    }
 
-                if (tempJson.containsKey(PROPERTY_COUNT)) {
-                    animationCount = tempJson[PROPERTY_COUNT].as<int>();
-                    this -> rlog -> log(log_prefix, "New count: " + (String) animationCount);
-                }
+    void renderLoop() {
+        for (;;) {
+            int64_t frameTime = scheduler.waitNextFrame();
+            measureJitter(scheduler.getLateness());
 
-                if (tempJson.containsKey(PROPERTY_INFINITY)) {
-                    infinityAnimation = tempJson[PROPERTY_INFINITY].as<bool>();
-                    this -> rlog -> log(log_prefix, "Infinity: " + (String) animationSpeed);
-                }
+            DiceCommand command;
+            while (commandQueue.pop(command)) {
+                applyCommand(command);
+            }
 
-                if (tempJson.containsKey(PROPERTY_COLOR)) {
-                    currentColor = tempJson[PROPERTY_COLOR].as<String>();
-                    this -> rlog -> log(log_prefix, "Color: " + (String) currentColor);
-                }
+            renderFrame(frameTime);
+            updateState();
+            if (Metrics::get(METRIC_FRAMES) == 0) {
+                BootTimeline::mark(BOOT_FIRST_FRAME);
+            }
+            Metrics::increment(METRIC_FRAMES);
+        }
+    }
 
-                if (tempJson.containsKey(PROPERTY_NUMBER)) {
-                    currentDiceNumber = tempJson[PROPERTY_NUMBER].as<int>();
-                    this -> rlog -> log(log_prefix, "Number: " + (String) currentDiceNumber);
-                }
+    // Called from the render task only
+    void applyCommand(const DiceCommand &command) {
+        if (command.fields & DICE_FIELD_SPEED) {
+            animation.speed = command.speed;
+        }
+        if (command.fields & DICE_FIELD_COUNT) {
+            animation.count = command.count;
+        }
+        if (command.fields & DICE_FIELD_INFINITY) {
+            animation.infinity = command.infinity;
+        }
+        if (command.fields & DICE_FIELD_COLOR) {
+            animation.color = CRGB(command.color);
+        }
+        if (command.fields & DICE_FIELD_NUMBER) {
+            animation.number = command.number;
+        }
+        if (command.fields & DICE_FIELD_COMMAND) {
+            animation.start(command.command);
+            resetLedStrip();
+        }
+        if (command.fields & DICE_FIELD_BRIGHTNESS) {
+            ceilBrightness = command.brightness;
+        }
+    }
 
-                if (tempJson.containsKey(PROPERTY_NUMBER)) {
-                    currentDiceNumber = tempJson[PROPERTY_BRIGHTNESS].as<int>();
-                    this -> rlog -> log(log_prefix, "Brightness: " + (String) ceilBrightness);
+    // frameTime is the deadline of the frame, the animation steps are scheduled from it
+    void renderFrame(int64_t frameTime) {
+
+        // Fade up light
+        // But if we want to have speed motion, skip the fade up mechanism
+        bool fading = animation.speed > BRIGHTNESS_CONTROL_TIME_LIMIT;
+        if (fading) {
+            if (frameTime >= nextFadeTime) {
+                if (brightness == 0) {
+                    brightness = FADE_START;
                 }
 
-                
+                nextFadeTime = nextDeadline(nextFadeTime, DICE_FADE_PERIOD * 1000LL, frameTime);
+                brightness = (brightness * FADE_FACTOR) >> 8;
+                if (brightness > ceilBrightness << 8) {
+                    brightness = ceilBrightness << 8;
+                }
             }
-           
+        } else {
+            brightness = ceilBrightness << 8;
         }
 
-    private:
-
-    // Colorize the led to red and flash it
-    void errorLight() {
-        animationSpeed = 300;
-        infinityAnimation = true;
+        if (animation.isRunning() && brightness >= ceilBrightness << 8 && frameTime >= nextAnimationTime) {
+            uint32_t mask;
+            CRGB color;
+            animation.step(mask, color);
+            frame.fillMask(mask, color);
+            lastMask = mask;
+            lastColor = color;
+
+            nextAnimationTime = nextDeadline(nextAnimationTime, animation.speed * 1000LL, frameTime);
+            // Need for the fade up to star the animation from "black"
+            // Fast animations are shown at full brightness, a reset would put a black frame between their steps
+            if (fading) {
+                brightness = 0;
+            }
+        }
         
-        if (currentColor != "#FF0000") {
-            currentColor = "#FF0000";
-        } else {
-            currentColor = "#000000";
+        if (frame.show(brightness >> 8)) {
+            Metrics::increment(METRIC_LED_SHOWS);
         }
-        colorizeLedStrip();
     }
 
-    void colorizeLedStrip() {
-        resetLedStrip();
-        for (int i=0; i < NUM_LEDS; i++ ){
-            leds[i].setColorCode(getColorAsNumber(currentColor));            
+    // Next deadline of a periodic step
+    // Deadlines follow each other without drift. If the step was late more than a period (e.g. it waited for the fade up),
+    // the next period is started from the actual frame, so the missed steps are not run in a burst.
+    int64_t nextDeadline(int64_t deadline, int64_t period, int64_t frameTime) {
+        deadline += period;
+        if (deadline <= frameTime) {
+            deadline = frameTime + period;
         }
+        return deadline;
     }
 
-    void rollDiceAnimatedToSpinUp() {
-        
-        int randNum = random(1,7);
-        while (currentDiceNumber == randNum) {
-            randNum = random(1,7);
+    // Collect how late the frames started compared to their deadlines
+    // The result is published once in every second
+    void measureJitter(int64_t lateness) {
+        uint32_t jitter = (uint32_t) (lateness < 0 ? -lateness : lateness);
+        if (jitter > jitterMax) {
+            jitterMax = jitter;
         }
-        currentDiceNumber = randNum;
-        animationSpeed = animationSpeed * 0.7;
-        
-        if (animationSpeed < 100) {
-            animationSpeed = 100;
+        jitterSum += jitter;
+        jitterFrames++;
+
+        if (jitterFrames >= DICE_TARGET_FPS) {
+            reportedJitterMax = jitterMax;
+            reportedJitterAverage = jitterSum / jitterFrames;
+            jitterMax = 0;
+            jitterSum = 0;
+            jitterFrames = 0;
         }
-        
-        setDiceNumber(currentDiceNumber);        
     }
 
-    void rollDiceAnimatedToSlowDown() {
-        int randNum = random(1,7);
-        while (currentDiceNumber == randNum) {
-            randNum = random(1,7);
-        }
-        currentDiceNumber = randNum;
-        animationSpeed = animationSpeed * 1.05;
-        
-        if (animationSpeed < 50) {
-            animationSpeed = 50;
+    // Render task: save the actual state if it is changed
+    void updateState() {
+        DiceState actual;
+        actual.command = animation.getEffectId();
+        actual.number = animation.number;
+        actual.color = ((uint32_t) animation.color.r << 16) | ((uint32_t) animation.color.g << 8) | animation.color.b;
+        actual.brightness = ceilBrightness;
+        actual.count = animation.count;
+        actual.infinity = animation.infinity;
+        actual.running = animation.isRunning();
+
+        if (!actual.equals(state)) {
+            portENTER_CRITICAL(&stateLock);
+            state = actual;
+            stateVersion++;
+            portEXIT_CRITICAL(&stateLock);
         }
 
-        // We don't want to wait forever for the next number
-        if (animationSpeed > 3000) {
-            animationSpeed = 3000;
+        DiceSnapshot actualSnapshot = createSnapshot(actual);
+        if (!DiceSnapshotStore::equals(actualSnapshot, sharedSnapshot)) {
+            portENTER_CRITICAL(&stateLock);
+            sharedSnapshot = actualSnapshot;
+            portEXIT_CRITICAL(&stateLock);
+            DiceSnapshotStore::writeRtc(actualSnapshot);
         }
-
-        setDiceNumber(currentDiceNumber);
     }
 
-    // Random number of the dice
-    void rollDice() {
-        int randNum = random(1,7);
-        setDiceNumber(randNum);
+    // The frame is saved only if the animation is finished, a running animation is restarted after the reboot
+    DiceSnapshot createSnapshot(const DiceState &actual) {
+        DiceSnapshot result;
+        DiceSnapshotStore::clear(result);
+        result.command = actual.command;
+        result.number = actual.number;
+        result.brightness = actual.brightness;
+        result.infinity = actual.infinity;
+        result.running = actual.running;
+        result.color = actual.color;
+        result.speed = animation.speed;
+        result.count = actual.count;
+        if (!actual.running) {
+            result.frameMask = lastMask;
+            result.frameColor = ((uint32_t) lastColor.r << 16) | ((uint32_t) lastColor.g << 8) | lastColor.b;
+        }
+        return result;
     }
 
-    // Count the number of the dice UP
-    void countUp() {
-        if (currentDiceNumber >= 6) {
-            currentDiceNumber = 1;
-        } else {
-            currentDiceNumber++;
+    // Called from setup, before the render task is started
+    void restoreState() {
+        snapshotStore.setup();
+        DiceSnapshotStore::clear(flashSnapshot);
+        DiceSnapshotStore::clear(pendingSnapshot);
+        DiceSnapshotStore::clear(sharedSnapshot);
+        snapshotStore.readFlash(flashSnapshot);
+
+        DiceSnapshot saved;
+        if (!snapshotStore.read(saved)) {
+            this -> rlog -> log(log_prefix, "No saved state.");
+            return;
         }
-    }
 
-    // Count the number of the dice UP
-    void countDown() {
-        if (currentDiceNumber <= 1) {
-            currentDiceNumber = 6;
-        } else {
-            currentDiceNumber--;
+        animation.speed = saved.speed;
+        animation.count = saved.count;
+        animation.infinity = saved.infinity;
+        animation.color = CRGB(saved.color);
+        animation.number = saved.number;
+        ceilBrightness = saved.brightness;
+        animation.start(saved.command);
+
+        if (!saved.running) {
+            // Show the last frame at once without fade up
+            lastMask = saved.frameMask;
+            lastColor = CRGB(saved.frameColor);
+            frame.fillMask(lastMask, lastColor);
+            brightness = ceilBrightness << 8;
         }
+        frame.show(brightness >> 8);
+        BootTimeline::mark(BOOT_FIRST_FRAME);
+
+        // The RTC copy can be newer than the flash one, it is written after the delay if it differs
+        sharedSnapshot = saved;
+        pendingSnapshot = saved;
+        snapshotPending = true;
+        lastSnapshotChange = millis();
+        this -> rlog -> log(log_prefix, (String) "State is restored. Command: " + CommandParser::getCommandName(saved.command));
     }
 
-    // Set the right LED(s) on the strip to show the dice numbers
-    void setDiceNumber(int number) {
-
-        if (number > 6) {
-            number = 6;
-        }
-
-        if (number < 1) {
-            number = 1;
-        }
-
-        resetLedStrip();
-
-        switch (number) {
-            case 1:
-                leds[0].setColorCode(getColorAsNumber(currentColor));
-            break;
-            case 2:
-                leds[1].setColorCode(getColorAsNumber(currentColor));
-                leds[2].setColorCode(getColorAsNumber(currentColor));
-            break;
-            case 3:
-                leds[3].setColorCode(getColorAsNumber(currentColor));
-                leds[4].setColorCode(getColorAsNumber(currentColor));
-                leds[5].setColorCode(getColorAsNumber(currentColor));
-            break;
-            case 4:
-                leds[6].setColorCode(getColorAsNumber(currentColor));
-                leds[7].setColorCode(getColorAsNumber(currentColor));
-                leds[8].setColorCode(getColorAsNumber(currentColor));
-                leds[9].setColorCode(getColorAsNumber(currentColor));
-            break;
-            case 5:
-                leds[10].setColorCode(getColorAsNumber(currentColor));
-                leds[11].setColorCode(getColorAsNumber(currentColor));
-                leds[12].setColorCode(getColorAsNumber(currentColor));
-                leds[13].setColorCode(getColorAsNumber(currentColor));
-                leds[14].setColorCode(getColorAsNumber(currentColor));
-            break;
-            case 6:
-                leds[15].setColorCode(getColorAsNumber(currentColor));
-                leds[16].setColorCode(getColorAsNumber(currentColor));
-                leds[17].setColorCode(getColorAsNumber(currentColor));
-                leds[18].setColorCode(getColorAsNumber(currentColor));
-                leds[19].setColorCode(getColorAsNumber(currentColor));
-                leds[20].setColorCode(getColorAsNumber(currentColor));
-            break;
+    // Arduino loop: write the snapshot to the flash when its settings have not changed for DICE_SNAPSHOT_DELAY
+    // The latest progress of a running animation is written with them, but it does not delay the write.
+    void persistState() {
+        DiceSnapshot actual;
+        portENTER_CRITICAL(&stateLock);
+        actual = sharedSnapshot;
+        portEXIT_CRITICAL(&stateLock);
+
+        if (!DiceSnapshotStore::sameSettings(actual, pendingSnapshot)) {
+            lastSnapshotChange = millis();
+            snapshotPending = true;
         }
-    }
+        pendingSnapshot = actual;
 
-    // Set all LEDs to blak (switch them off)
-    void resetLedStrip() {
-        for (int i=0; i < NUM_LEDS; i++ ){
-            leds[i] = CRGB::Black;
+        if (snapshotPending && millis() - lastSnapshotChange >= DICE_SNAPSHOT_DELAY) {
+            snapshotPending = false;
+            if (!DiceSnapshotStore::sameSettings(pendingSnapshot, flashSnapshot)) {
+                if (snapshotStore.writeFlash(pendingSnapshot)) {
+                    flashSnapshot = pendingSnapshot;
+                } else {
+                    this -> rlog -> log(log_prefix, "State cannot be saved.");
+                }
+            }
         }
-        // FastLED.clear();
     }
 
-    uint32_t getColorAsNumber(String colorCode) { //incoming looks like this -> #00FF00       
-        String colorString = "0x" + colorCode.substring(1); // remove #
-        uint32_t color = strtol(colorString.c_str(), NULL, 16);
-        return color;
+    // Arduino loop: publish the state as a retained message if it is changed, at most once in DICE_STATE_MIN_INTERVAL
+    void publishState() {
+        if (stateVersion == publishedVersion || millis() - lastStatePublish < DICE_STATE_MIN_INTERVAL) {
+            return;
+        }
+
+        DiceState snapshot;
+        portENTER_CRITICAL(&stateLock);
+        snapshot = state;
+        publishedVersion = stateVersion;
+        portEXIT_CRITICAL(&stateLock);
+
+        if (lastStatePublish != 0 && snapshot.equals(publishedState)) {
+            return;
+        }
+        publishedState = snapshot;
+        lastStatePublish = millis();
+
+        snprintf(stateBuffer, sizeof(stateBuffer),
+            "{\"" PROPERTY_COMMAND "\":\"%s\",\"" PROPERTY_NUMBER "\":%u,\"" PROPERTY_COLOR "\":\"#%06X\",\"" PROPERTY_BRIGHTNESS "\":%u,\"" PROPERTY_COUNT "\":%d,\"" PROPERTY_INFINITY "\":%s,\"running\":%s}",
+            CommandParser::getCommandName(snapshot.command), (unsigned int) snapshot.number, (unsigned int) snapshot.color, (unsigned int) snapshot.brightness,
+            snapshot.count, snapshot.infinity ? "true" : "false", snapshot.running ? "true" : "false");
+
+        this -> message -> fire(MQTTMessage {DICE_STATE_TOPIC, stateBuffer, true});
     }
 
-    bool is_number(const String& s)
-    {
-        return !s.isEmpty() && std::find_if(s.begin(), 
-            s.end(), [](unsigned char c) { return !std::isdigit(c); }) == s.end();
+    // Set all LEDs to blak (switch them off)
+    void resetLedStrip() {
+        frame.clear();
     }
-     
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef DICESNAPSHOT
+#define DICESNAPSHOT
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_attr.h>
+#include <rom/crc.h>
+#include "definitions.h"
+
+// Last state of the dice which is restored after a reboot
+struct DiceSnapshot {
+    uint32_t magic;
+    uint8_t command;
+    uint8_t number;
+    uint8_t brightness;
+    bool infinity;
+    bool running;
+    uint32_t color; // 0xRRGGBB
+    uint32_t speed;
+    int32_t count;
+    // Last shown frame, it is set only when the animation is finished
+    uint32_t frameMask;
+    uint32_t frameColor;
+    uint32_t crc;
+};
+
+// Snapshot in the RTC slow memory and in the flash
+// The RTC memory is not initialized by a soft reset (restart, watchdog, OTA), so it has the newest state without flash wear.
+// The flash copy is written rarely (debounced by the Dice), it covers a power loss.
+class DiceSnapshotStore {
+
+    Preferences store;
+
+    static DiceSnapshot& rtcSnapshot() {
+        static RTC_NOINIT_ATTR DiceSnapshot snapshot;
+        return snapshot;
+    }
+
+    static uint32_t checksum(const DiceSnapshot &snapshot) {
+        return crc32_le(0, (const uint8_t*) &snapshot, offsetof(DiceSnapshot, crc));
+    }
+
+    static bool isValid(const DiceSnapshot &snapshot) {
+        return snapshot.magic == DICE_SNAPSHOT_MAGIC && snapshot.crc == checksum(snapshot);
+    }
+
+    public:
+        // The stored bytes (and the CRC) include the padding, it is cleared so no stack garbage goes to the flash
+        static void clear(DiceSnapshot &snapshot) {
+            memset(&snapshot, 0, sizeof(DiceSnapshot));
+            snapshot.magic = DICE_SNAPSHOT_MAGIC;
+        }
+
+        // Field by field, a copy returned by value does not keep the padding
+        static bool equals(const DiceSnapshot &first, const DiceSnapshot &second) {
+            return first.magic == second.magic
+                && first.command == second.command
+                && first.number == second.number
+                && first.brightness == second.brightness
+                && first.infinity == second.infinity
+                && first.running == second.running
+                && first.color == second.color
+                && first.speed == second.speed
+                && first.count == second.count
+                && first.frameMask == second.frameMask
+                && first.frameColor == second.frameColor;
+        }
+
+        // Equal for the flash copy: the progress of a running animation (number, speed, count, frame) changes
+        // on every step, so it is compared only when the animation is finished. Otherwise an infinite animation
+        // would never be quiet long enough to be saved.
+        static bool sameSettings(const DiceSnapshot &first, const DiceSnapshot &second) {
+            if (!first.running || !second.running) {
+                return equals(first, second);
+            }
+            return first.magic == second.magic
+                && first.command == second.command
+                && first.brightness == second.brightness
+                && first.infinity == second.infinity
+                && first.color == second.color;
+        }
+
+        void setup() {
+            store.begin(DICE_SNAPSHOT_NAMESPACE, false);
+        }
+
+        // RTC copy first, the flash copy after a power loss
+        bool read(DiceSnapshot &snapshot) {
+            if (isValid(rtcSnapshot())) {
+                snapshot = rtcSnapshot();
+                return true;
+            }
+            return readFlash(snapshot);
+        }
+
+        bool readFlash(DiceSnapshot &snapshot) {
+            DiceSnapshot copy;
+            if (store.getBytesLength(DICE_SNAPSHOT_KEY) == sizeof(DiceSnapshot)
+                && store.getBytes(DICE_SNAPSHOT_KEY, &copy, sizeof(DiceSnapshot)) == sizeof(DiceSnapshot)
+                && isValid(copy)) {
+                snapshot = copy;
+                return true;
+            }
+            return false;
+        }
+
+        // The caller must not write it from two tasks at the same time
+        static void writeRtc(const DiceSnapshot &snapshot) {
+            DiceSnapshot &rtc = rtcSnapshot();
+            rtc = snapshot;
+            rtc.crc = checksum(rtc);
+        }
+
+        bool writeFlash(const DiceSnapshot &snapshot) {
+            DiceSnapshot copy = snapshot;
+            copy.crc = checksum(copy);
+            return store.putBytes(DICE_SNAPSHOT_KEY, &copy, sizeof(DiceSnapshot)) == sizeof(DiceSnapshot);
+        }
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef FRAMESCHEDULER
+#define FRAMESCHEDULER
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Fixed rate frame scheduler
+// Frames have absolute deadlines on the 64 bit esp_timer timebase (us), so the timing does not drift
+// when a frame starts late and there is no 32 bit wrap around to handle.
+class FrameScheduler {
+
+    public:
+        // What to do if the task is so late that a deadline has already passed
+        enum Policy {
+            catchUp, // run the missed frames back to back (at most maxCatchUp) to keep the frame count
+            drop // skip the missed frames and continue with the next deadline in the future
+        };
+
+    private:
+        int64_t period = 10000;
+        int64_t nextDeadline = 0;
+        Policy policy = drop;
+        uint32_t maxCatchUp = 3;
+
+        uint32_t frames = 0;
+        uint32_t missedDeadlines = 0; // Frames which started after the deadline of the next one (overruns)
+        uint32_t droppedFrames = 0;
+        int64_t lateness = 0;
+
+    public:
+        void setup(uint16_t fps, Policy policy) {
+            setFps(fps);
+            this -> policy = policy;
+            nextDeadline = 0;
+        }
+
+        void setFps(uint16_t fps) {
+            if (fps == 0) {
+                fps = 1;
+            }
+            period = 1000000LL / fps;
+        }
+
+        void setMaxCatchUp(uint32_t maxCatchUp) {
+            this -> maxCatchUp = maxCatchUp;
+        }
+
+        // Sleep till the deadline of the next frame
+        // Returns the deadline of the frame which should be rendered now (us)
+        int64_t waitNextFrame() {
+            int64_t now = esp_timer_get_time();
+            if (nextDeadline == 0) {
+                nextDeadline = now;
+            }
+
+            if (nextDeadline > now) {
+                // Round up to whole ticks, so the frame never starts before its deadline
+                TickType_t ticks = (nextDeadline - now + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000);
+                vTaskDelay(ticks);
+                now = esp_timer_get_time();
+            }
+
+            int64_t deadline = nextDeadline;
+            lateness = now - deadline;
+            nextDeadline += period;
+            frames++;
+
+            // The frame started after the deadline of the next one
+            if (now >= nextDeadline) {
+                missedDeadlines++;
+
+                // Number of the deadlines which are already gone
+                uint32_t behind = (now - nextDeadline) / period + 1;
+                if (policy == drop || behind > maxCatchUp) {
+                    nextDeadline += behind * period;
+                    droppedFrames += behind;
+                }
+            }
+
+            return deadline;
+        }
+
+        int64_t getPeriod() {
+            return period;
+        }
+
+        // How late the last frame started compared to its deadline (us)
+        int64_t getLateness() {
+            return lateness;
+        }
+
+        uint32_t getFrames() {
+            return frames;
+        }
+
+        uint32_t getMissedDeadlines() {
+            return missedDeadlines;
+        }
+
+        uint32_t getDroppedFrames() {
+            return droppedFrames;
+        }
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef LEDFRAME
+#define LEDFRAME
+
+#include <FastLED.h>
+#include "metrics.cpp"
+
+// Double buffered frame of the LED strip
+// Pixels are drawn to the back buffer only through this class, so it knows when the frame is changed (dirty).
+// The front buffer is registered in FastLED. The back buffer is copied to it right before show(),
+// so drawing never touches the pixels which are under transmission.
+// The frame is pushed to the strip only when the pixels or the brightness changed,
+// or when the keep alive interval is elapsed (0 means no keep alive refresh).
+template<int LED_COUNT>
+class LedFrame {
+
+    CRGB front[LED_COUNT];
+    CRGB back[LED_COUNT];
+
+    bool dirty = true;
+    uint8_t lastBrightness = 0;
+    unsigned long lastShowTime = 0;
+    unsigned long keepAliveInterval = 0;
+
+    // Counters to measure the saving
+    uint32_t showsPerformed = 0;
+    uint32_t showsSkipped = 0;
+
+    public:
+        LedFrame() {
+            fill_solid(front, LED_COUNT, CRGB::Black);
+            fill_solid(back, LED_COUNT, CRGB::Black);
+        }
+
+        // FastLED needs the array itself (front buffer)
+        CRGB* getPixels() {
+            return front;
+        }
+
+        void setKeepAliveInterval(unsigned long keepAliveInterval) {
+            this -> keepAliveInterval = keepAliveInterval;
+        }
+
+        void setPixel(int index, const CRGB &color) {
+            if (back[index] != color) {
+                back[index] = color;
+                dirty = true;
+            }
+        }
+
+        void fill(const CRGB &color) {
+            for (int i=0; i < LED_COUNT; i++ ){
+                setPixel(i, color);
+            }
+        }
+
+        // Light the LEDs which bit is set in the mask, switch off the others
+        void fillMask(uint32_t mask, const CRGB &color) {
+            for (int i=0; i < LED_COUNT; i++ ){
+                setPixel(i, (mask & (1UL << i)) ? color : CRGB(CRGB::Black));
+            }
+        }
+
+        void clear() {
+            fill(CRGB::Black);
+        }
+
+        // Push the frame to the strip if it is needed
+        // Returns true if FastLED.show() was called
+        bool show(uint8_t brightness) {
+            unsigned long now = millis();
+            bool keepAlive = keepAliveInterval > 0 && now - lastShowTime >= keepAliveInterval;
+
+            if (!dirty && brightness == lastBrightness && !keepAlive) {
+                showsSkipped++;
+                return false;
+            }
+
+            if (dirty) {
+                memcpy(front, back, sizeof(front));
+            }
+            FastLED.setBrightness(brightness);
+            unsigned long showStart = micros();
+            FastLED.show();
+            Metrics::observe(HISTOGRAM_LED_SHOW, micros() - showStart);
+
+            dirty = false;
+            lastBrightness = brightness;
+            lastShowTime = now;
+            showsPerformed++;
+            return true;
+        }
+
+        uint32_t getShowsPerformed() {
+            return showsPerformed;
+        }
+
+        uint32_t getShowsSkipped() {
+            return showsSkipped;
+        }
+};
+
+#endif
@@ -8,7 +8,19 @@
 #include "log.cpp"
 #include "utilities.cpp"
 #include "database.cpp"
+#include "publishqueue.cpp"
+#include "metrics.cpp"
+#include "boot.cpp"
 #include <Callback.h>
+#include <atomic>
+
+// State of the MQTT connection
+enum MqttState {
+    MQTT_IDLE, // No network
+    MQTT_WAITING, // Waiting for the next try (backoff)
+    MQTT_CONNECTING, // The connect task is running, the client must not be used
+    MQTT_CONNECTED
+};
 
 class Mqtt {
 
@@ -18,46 +30,69 @@ class Mqtt {
     MqttClient* client;
     Database* database;
     Signal<int>* errorCodeChanged;
-    Signal<String>* mqttMessageArrived;
+    Signal<RawMessage>* mqttMessageArrived;
     String server;
     String user;
     String password;
     int port;
     String baseTopic;
+    String inTopic; // Commands arrive on this topic and its subtopics
 
     // MQTT connect try
-    int lasttry = 10000;
-    int maxtry = 10;
+    // The blocking connect runs in its own task, the loop only checks the result
+    MqttState state = MQTT_IDLE;
+    std::atomic<int> connectResult; // 0: in progress, 1: connected, -1: failed
+    unsigned long nextTry = 0;
+    uint32_t retryDelay = 0; // Delay before the next try (ms), grows exponentially
+    uint32_t reconnects = 0;
 
     boolean networkConnected = false; // Connected to the network (Wifi STA)
     boolean subscribed = false;
+    uint32_t pendingChanges = 0; // CONFIG_CHANGED_* bits which are not applied yet
+
+    // Incoming payloads are read here, so receiving does not allocate
+    char payload[MQTT_MAX_PAYLOAD_SIZE + 1];
+    uint32_t oversizeMessages = 0;
+
+    // Outgoing messages wait here for the loop, they survive a short disconnect
+    PublishQueue publishQueue;
+    uint32_t publishFailures = 0;
 
     public:
         Mqtt(Log &log) {
             this -> rlog = &log;
             this -> client = new MqttClient(wifiClient);
+            this -> connectResult = 0;
         }
 
-        void setup(Database &database, Signal<int> &errorCodeChanged, Signal<String> &mqttMessageArrived) {
+        void setup(Database &database, Signal<int> &errorCodeChanged, Signal<RawMessage> &mqttMessageArrived) {
 
             this -> database = &database;
             this -> errorCodeChanged = &errorCodeChanged;
             this -> mqttMessageArrived = &mqttMessageArrived;
             
-            this -> user = this -> database -> getValueAsString(String(DB_MQTT_USER), false);
-            this -> password = this -> database -> getValueAsString(String(DB_MQTT_PW), false);
-            this -> port =  this -> database -> getValueAsInt(String(DB_MQTT_PORT), false);
-            this -> server = this -> database -> getValueAsString(String(DB_MQTT_SERVER), false);
-            this -> baseTopic = this -> database -> getValueAsString(String(DB_MQTT_TOPIC_PREFIX), false) + MQTT_TOPIC;
-            
-            this -> client -> setUsernamePassword(user, password);
-            
+            readConfig();
         }
 
         void loop() {
+            // The connect task uses the server settings, they are changed only when it is not running
+            if (pendingChanges != 0 && state != MQTT_CONNECTING) {
+                applyConfigChanges();
+            }
+
+
+            if (state == MQTT_CONNECTING) {
+                int result = connectResult.load();
+                if (result == 0) {
+                    // Still connecting, nothing to do
+                    return;
+                }
+                connectFinished(result > 0);
+            }
+
             if (networkConnected) {
                 // check for incoming messages            
-                if (client->connected()) {
+                if (state == MQTT_CONNECTED && client->connected()) {
 
                     if (!subscribed) {
                         subscribeForBaseTopic();
@@ -65,16 +100,31 @@ class Mqtt {
 
                     int messageSize = client -> parseMessage();
                     if (messageSize) {
-                       processMessage();
+                       processMessage(messageSize);
                     }
+
+                    publishQueued();
                 } else {
-                    client->stop();
-                    subscribed = false;
-                    reconnect();
+                    if (state == MQTT_CONNECTED) {
+                        // Connection is lost
+                        this -> rlog -> log(log_prefix, "Connection lost.");
+                        client->stop();
+                        subscribed = false;
+                        scheduleRetry();
+                    } else if (state == MQTT_IDLE) {
+                        state = MQTT_WAITING;
+                        nextTry = millis();
+                    }
+
+                    if (state == MQTT_WAITING && (long) (millis() - nextTry) >= 0) {
+                        reconnect();
+                    }
                 }
-            } else {
+            } else if (state != MQTT_IDLE) {
                 client->stop();
                 subscribed = false;
+                state = MQTT_IDLE;
+                retryDelay = 0;
             }
         }
 
@@ -83,13 +133,77 @@ class Mqtt {
             this->networkConnected = networkConnected;            
         }
 
+        // Config is changed (e.g. on the web UI), only the changed parts are applied
+        void receiveConfigChange(uint32_t changes) {
+            pendingChanges |= changes & (CONFIG_CHANGED_MQTT_SERVER | CONFIG_CHANGED_MQTT_TOPIC);
+        }
+
+        // Number of the incoming messages which were dropped, because they did not fit in the payload buffer
+        uint32_t getOversizeMessages() {
+            return oversizeMessages;
+        }
+
+        // Number of the successful connections after a lost connection or a failed try
+        uint32_t getReconnects() {
+            return reconnects;
+        }
+
+        MqttState getState() {
+            return state;
+        }
+
+        // Queue the message, it is published by the loop
         void sendMqttMessage(MQTTMessage message) {
-            if (client->connected()) {
-                sendMqttMessage(baseTopic + "/" + message.topic, message.payload, message.retain);
+            if (!publishQueue.push(message.topic.c_str(), message.payload.c_str(), message.retain)) {
+                this -> rlog -> log(log_prefix, "Message is too large for the publish queue: " + message.topic);
             }
         }
 
+        // Messages which could not be written to the client, they were kept in the queue
+        uint32_t getPublishFailures() {
+            return publishFailures;
+        }
+
     private:
+
+        void readConfig() {
+            const Config &config = this -> database -> getConfig();
+            this -> user = config.mqttUser;
+            this -> password = config.mqttPassword;
+            this -> port = config.mqttPort;
+            this -> server = config.mqttServer;
+            this -> baseTopic = String(config.mqttPrefix) + MQTT_TOPIC;
+            this -> inTopic = baseTopic + MQTT_IN_POSTFIX;
+            
+            this -> client -> setUsernamePassword(user, password);
+        }
+
+        void applyConfigChanges() {
+            uint32_t changes = pendingChanges;
+            pendingChanges = 0;
+
+            // New prefix: switch the old status off, the reconnect below moves the subscription and the last will
+            if ((changes & CONFIG_CHANGED_MQTT_TOPIC) && subscribed) {
+                sendMqttMessage(baseTopic, MQTT_STATUS_OFF);
+            }
+
+            readConfig();
+
+            // New broker, credentials or prefix: reconnect now (the last will is sent to the broker only at connect)
+            if (changes & (CONFIG_CHANGED_MQTT_SERVER | CONFIG_CHANGED_MQTT_TOPIC)) {
+                if (state == MQTT_CONNECTED) {
+                    client -> stop();
+                    subscribed = false;
+                }
+                if (state != MQTT_IDLE) {
+                    state = MQTT_WAITING;
+                    retryDelay = 0;
+                    nextTry = millis();
+                }
+            }
+
+            rlog -> log(log_prefix, "Config is applied. Topic: " + baseTopic);
+        }
     
         void setLastWill() {
             client -> beginWill(baseTopic, String(MQTT_STATUS_OFF).length(), false, 1);
@@ -105,44 +219,132 @@ class Mqtt {
             client -> endMessage();
         }
 
+        // Publish the queued messages in one batch per loop pass
+        void publishQueued() {
+            int budget = MQTT_PUBLISH_BUDGET;
+            QueuedMessage* message;
+            while (budget-- > 0 && (message = publishQueue.peek()) != NULL) {
+                // A failed message stays in the queue, it is sent again in the next pass (or after the reconnect)
+                if (!client -> beginMessage(baseTopic + "/" + message -> topic, message -> retain)) {
+                    publishFailed();
+                    return;
+                }
+                client -> print(message -> payload);
+                if (!client -> endMessage()) {
+                    publishFailed();
+                    return;
+                }
+                publishQueue.pop();
+                Metrics::increment(METRIC_MQTT_MESSAGES_OUT);
+            }
+        }
+
+        void publishFailed() {
+            publishFailures++;
+            Metrics::increment(METRIC_MQTT_PUBLISH_FAILURES);
+        }
+
+        // Start a connection in the background
         void reconnect() {
             if (!String("").equals(server) && !String("").equals(user)) {
-                const char* mqtt_s = const_cast<char*>(server.c_str());
-                if (!client -> connect(mqtt_s, port)) {                    
-                    this -> rlog -> log(log_prefix, (String) "MQTT connection failed! Error code = " + client -> connectError());
-                    this -> errorCodeChanged->fire(ERROR_MQTT);
-                } else {
-                    rlog -> log(log_prefix, "Connection started.");
+                // The last will is a part of the connect packet, it is set with the actual topic before every connect
+                setLastWill();
+                state = MQTT_CONNECTING;
+                connectResult = 0;
+                if (xTaskCreatePinnedToCore(connectTask, "mqttconnect", MQTT_CONNECT_STACK_SIZE, this, 1, NULL, MQTT_CONNECT_CORE) != pdPASS) {
+                    connectResult = -1;
                 }
             } else {
                 // rlog -> log(log_prefix, "MQTT connection info is missing.");
+                scheduleRetry();
             }
         }
 
-        void processMessage() {
-             // we received a message, print out the topic and contents
-            this -> rlog -> log(log_prefix, (String) "Message received on topic: " + client -> messageTopic());
-            
-            String message = "";
-            while (client -> available()) {
-                message += (char) client -> read();
+        static void connectTask(void* parameter) {
+            Mqtt* mqtt = (Mqtt*) parameter;
+            bool connected = mqtt -> client -> connect(mqtt -> server.c_str(), mqtt -> port);
+            mqtt -> connectResult = connected ? 1 : -1;
+            vTaskDelete(NULL);
+        }
+
+        void connectFinished(bool connected) {
+            if (connected) {
+                rlog -> log(log_prefix, "Connection started.");
+                if (retryDelay > 0) {
+                    reconnects++;
+                    Metrics::increment(METRIC_MQTT_RECONNECTS);
+                }
+                state = MQTT_CONNECTED;
+                retryDelay = 0;
+            } else {
+                this -> rlog -> log(log_prefix, (String) "MQTT connection failed! Error code = " + client -> connectError());
+                this -> errorCodeChanged->fire(ERROR_MQTT);
+                scheduleRetry();
+            }
+        }
+
+        // Exponential backoff with jitter
+        // The delay is doubled after every failure up to MQTT_RETRY_MAX, the next try is in the second half of the delay randomly.
+        void scheduleRetry() {
+            if (retryDelay == 0) {
+                retryDelay = MQTT_RETRY_MIN;
+            } else {
+                retryDelay = min((uint32_t) MQTT_RETRY_MAX, retryDelay * 2);
+            }
+            state = MQTT_WAITING;
+            uint32_t wait = retryDelay / 2 + random(retryDelay / 2 + 1);
+            nextTry = millis() + wait;
+            rlog -> log(log_prefix, (String) "Next try in " + wait + " ms.");
+        }
+
+        void processMessage(int messageSize) {
+            // Only the dropped messages are logged, a log line per message costs more than the command itself
+            String topic = client -> messageTopic();
+            Metrics::increment(METRIC_MQTT_MESSAGES_IN);
+
+            // Oversize policy: the message is dropped, it is read out in buffer sized chunks
+            if (messageSize > MQTT_MAX_PAYLOAD_SIZE) {
+                while (client -> available()) {
+                    client -> read((uint8_t*) payload, MQTT_MAX_PAYLOAD_SIZE);
+                }
+                oversizeMessages++;
+                this -> rlog -> log(log_prefix, (String) "Message is too large, dropped. Limit: " + MQTT_MAX_PAYLOAD_SIZE);
+                return;
             }
-            // Broadcast MQTT message
-            this -> mqttMessageArrived->fire(message);
-            this -> rlog -> log(log_prefix, (String) "Message: " + message);
+
+            size_t length = readPayload(messageSize);
+
+            // The router uses the subtopic as a key (e.g. /dice/in/number -> /number)
+            const char* subtopic = topic.startsWith(inTopic) ? topic.c_str() + inTopic.length() : "";
+
+            // Broadcast MQTT message, the payload is not copied. It is parsed in place in the buffer.
+            this -> mqttMessageArrived->fire(RawMessage {payload, length, subtopic});
+        }
+
+        // Bulk read of the payload into the preallocated buffer
+        size_t readPayload(int messageSize) {
+            size_t length = 0;
+            while (length < (size_t) messageSize) {
+                int count = client -> read((uint8_t*) payload + length, messageSize - length);
+                if (count <= 0) {
+                    break;
+                }
+                length += count;
+            }
+            payload[length] = '\0';
+            return length;
         }
 
         void subscribeForBaseTopic () {
             // subscribe to a topic and send an 'I'm alive' message
-            String subscription = baseTopic + MQTT_IN_POSTFIX + "/#";
+            String subscription = inTopic + "/#";
             client -> subscribe(subscription);
             sendMqttMessage(baseTopic, MQTT_STATUS_ON);
             rlog -> log(log_prefix, "Subscribed to topic " + subscription);
-            
-            setLastWill();
 
             this -> errorCodeChanged->fire(ERROR_NO_ERROR);
             subscribed = true;
+            BootTimeline::mark(BOOT_MQTT_SUBSCRIBED);
         }
         
         
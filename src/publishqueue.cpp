@@ -0,0 +1,84 @@
+#ifndef PUBLISHQUEUE
+#define PUBLISHQUEUE
+
+#include "definitions.h"
+#include <Arduino.h>
+#include "metrics.cpp"
+
+struct QueuedMessage {
+    char topic[MQTT_QUEUE_TOPIC_SIZE];
+    char payload[MQTT_QUEUE_PAYLOAD_SIZE];
+    bool retain;
+};
+
+// Bounded ring buffer of the outgoing MQTT messages
+// Retained messages are state: a newer message to the same topic replaces the queued one (latest value wins).
+// If the queue is full, the oldest message is dropped.
+class PublishQueue {
+
+    QueuedMessage messages[MQTT_QUEUE_SIZE];
+    size_t first = 0;
+    size_t count = 0;
+
+    // The depth, the high water and the drops are reported through Metrics
+    size_t highWater = 0;
+
+    public:
+        // Returns false if the message does not fit in a slot
+        bool push(const char* topic, const char* payload, bool retain) {
+            if (strlen(topic) >= MQTT_QUEUE_TOPIC_SIZE || strlen(payload) >= MQTT_QUEUE_PAYLOAD_SIZE) {
+                Metrics::increment(METRIC_MQTT_QUEUE_DROPS);
+                return false;
+            }
+
+            if (retain) {
+                for (size_t i = 0; i < count; i++) {
+                    QueuedMessage &message = messages[(first + i) % MQTT_QUEUE_SIZE];
+                    if (message.retain && strcmp(message.topic, topic) == 0) {
+                        strcpy(message.payload, payload);
+                        Metrics::increment(METRIC_MQTT_QUEUE_MERGED);
+                        return true;
+                    }
+                }
+            }
+
+            if (count == MQTT_QUEUE_SIZE) {
+                // Drop the oldest one
+                first = (first + 1) % MQTT_QUEUE_SIZE;
+                count--;
+                Metrics::increment(METRIC_MQTT_QUEUE_DROPS);
+            }
+
+            QueuedMessage &message = messages[(first + count) % MQTT_QUEUE_SIZE];
+            strcpy(message.topic, topic);
+            strcpy(message.payload, payload);
+            message.retain = retain;
+            count++;
+
+            if (count > highWater) {
+                highWater = count;
+                Metrics::set(GAUGE_MQTT_QUEUE_HIGH_WATER, highWater);
+            }
+            Metrics::set(GAUGE_MQTT_QUEUE_DEPTH, count);
+            return true;
+        }
+
+        // Oldest message, NULL if the queue is empty
+        QueuedMessage* peek() {
+            return count > 0 ? &messages[first] : NULL;
+        }
+
+        void pop() {
+            if (count > 0) {
+                first = (first + 1) % MQTT_QUEUE_SIZE;
+                count--;
+                Metrics::set(GAUGE_MQTT_QUEUE_DEPTH, count);
+            }
+        }
+
+        size_t size() {
+            return count;
+        }
+};
+
+#endif
@@ -0,0 +1,288 @@
+#ifndef ROUTER
+#define ROUTER
+
+#include "definitions.h"
+#include <ArduinoJson.h> // version 6
+#include <Callback.h>
+#include "log.cpp"
+#include "utilities.cpp"
+#include "command.cpp"
+#include "metrics.cpp"
+
+// How the payload of a topic is handled
+enum TopicKind : uint8_t {
+    TOPIC_JSON, // Full JSON command
+    TOPIC_BINARY, // Binary command frame
+    TOPIC_COMMAND, // Name or number of a dice command
+    TOPIC_INTEGER, // Integer value of a single property
+    TOPIC_COLOR, // Color code
+    TOPIC_BOOLEAN // true/false or 1/0
+};
+
+struct TopicRoute {
+    const char* suffix; // Topic after the input topic
+    TopicKind kind;
+    uint8_t field; // DICE_FIELD_* bit of the property
+};
+
+// Single properties can be set on their own topic without the JSON parser, e.g. /dice/in/number with payload 4
+// Every other topic under the input topic is a JSON command.
+static constexpr TopicRoute TOPIC_ROUTES[] = {
+    {"", TOPIC_JSON, 0},
+    {MQTT_BINARY_POSTFIX, TOPIC_BINARY, 0},
+    {"/" PROPERTY_COMMAND, TOPIC_COMMAND, DICE_FIELD_COMMAND},
+    {"/" PROPERTY_NUMBER, TOPIC_INTEGER, DICE_FIELD_NUMBER},
+    {"/" PROPERTY_COLOR, TOPIC_COLOR, DICE_FIELD_COLOR},
+    {"/" PROPERTY_BRIGHTNESS, TOPIC_INTEGER, DICE_FIELD_BRIGHTNESS},
+    {"/" PROPERTY_SPEED, TOPIC_INTEGER, DICE_FIELD_SPEED},
+    {"/" PROPERTY_COUNT, TOPIC_INTEGER, DICE_FIELD_COUNT},
+    {"/" PROPERTY_INFINITY, TOPIC_BOOLEAN, DICE_FIELD_INFINITY}
+};
+
+// Parses every incoming message once and passes the result only to the module which owns the command
+// Dice commands are converted to a DiceCommand, config commands are passed as a parsed JSON object.
+class CommandRouter {
+
+    Log* rlog;
+    String log_prefix = "[ROUTER] ";
+    Signal<JsonObject>* configCommandArrived;
+    Signal<DiceCommand>* diceCommandArrived;
+
+    static const int NO_COMMAND = -1;
+
+    // Reused for every message, so it is not on the stack of the subscribers
+    StaticJsonDocument<1000> json;
+
+    public:
+        CommandRouter(Log &log) {
+            this -> rlog = &log;
+        }
+
+        void setup(Signal<JsonObject> &configCommandArrived, Signal<DiceCommand> &diceCommandArrived) {
+            this -> configCommandArrived = &configCommandArrived;
+            this -> diceCommandArrived = &diceCommandArrived;
+        }
+
+        void route(RawMessage message) {
+            Metrics::increment(METRIC_COMMANDS);
+            const TopicRoute* topicRoute = findTopicRoute(message.topic);
+
+            switch (topicRoute -> kind) {
+                case TOPIC_JSON:
+                    routeJson(message);
+                    break;
+                case TOPIC_BINARY:
+                    routeBinary(message);
+                    break;
+                default:
+                    routeProperty(message, *topicRoute);
+                    break;
+            }
+        }
+
+    private:
+        // Unknown topics are handled as JSON
+        const TopicRoute* findTopicRoute(const char* topic) {
+            if (topic != NULL) {
+                for (const TopicRoute &route : TOPIC_ROUTES) {
+                    if (strcmp(route.suffix, topic) == 0) {
+                        return &route;
+                    }
+                }
+            }
+            return &TOPIC_ROUTES[0];
+        }
+
+        void routeBinary(RawMessage message) {
+            DiceCommand command;
+            if (BinaryCommand::decode((const uint8_t*) message.payload, message.length, command)) {
+                this -> diceCommandArrived -> fire(command);
+            } else {
+                Metrics::increment(METRIC_PARSE_ERRORS);
+                rlog -> log(log_prefix, (String) "Binary command is not valid. Length: " + message.length);
+            }
+        }
+
+        // Fast path, the payload is the value of a single property
+        void routeProperty(RawMessage message, const TopicRoute &topicRoute) {
+            DiceCommand command = {};
+            bool valid = false;
+            int value = 0;
+
+            // Surrounding whitespaces (e.g. a new line from a command line client) are allowed for every property
+            while (message.length > 0 && isspace(message.payload[message.length - 1])) {
+                message.length--;
+            }
+            message.payload[message.length] = '\0';
+            while (message.length > 0 && isspace(message.payload[0])) {
+                message.payload++;
+                message.length--;
+            }
+
+            switch (topicRoute.kind) {
+                case TOPIC_COMMAND:
+                    if (CommandParser::parseInteger(message.payload, message.length, value)) {
+                        command.command = value >= 0 && value < DICE_COMMAND_COUNT ? value : DICE_COMMAND_ERROR;
+                        valid = true;
+                    } else {
+                        const CommandRoute* route = CommandParser::findRoute(message.payload);
+                        // Config needs the JSON form
+                        valid = route != NULL && route -> owner == OWNER_DICE;
+                        if (valid) {
+                            command.command = route -> id;
+                        }
+                    }
+                    break;
+                case TOPIC_COLOR:
+                    valid = CommandParser::parseColor(message.payload, command.color);
+                    break;
+                case TOPIC_BOOLEAN:
+                    valid = CommandParser::parseBoolean(message.payload, command.infinity);
+                    break;
+                case TOPIC_INTEGER:
+                    valid = CommandParser::parseInteger(message.payload, message.length, value) && value >= 0
+                        && CommandParser::isInRange(topicRoute.field, value);
+                    command.number = value;
+                    command.brightness = constrain(value, 0, 255);
+                    command.speed = value;
+                    command.count = value;
+                    break;
+                default:
+                    break;
+            }
+
+            if (valid) {
+                command.fields = topicRoute.field;
+                this -> diceCommandArrived -> fire(command);
+            } else {
+                Metrics::increment(METRIC_PARSE_ERRORS);
+                rlog -> log(log_prefix, (String) "Value is not valid on topic " + topicRoute.suffix);
+                // Unknown command is shown like on the JSON topic
+                if (topicRoute.kind == TOPIC_COMMAND) {
+                    routeError();
+                }
+            }
+        }
+
+        // Show the error effect on the dice
+        void routeError() {
+            DiceCommand command = {};
+            command.fields = DICE_FIELD_COMMAND;
+            command.command = DICE_COMMAND_ERROR;
+            this -> diceCommandArrived -> fire(command);
+        }
+
+        void routeJson(RawMessage message) {
+            // The payload is parsed in place (zero-copy), strings of the document point into it
+            DeserializationError error = deserializeJson(json, message.payload, message.length);
+
+            if (error) {
+                Metrics::increment(METRIC_PARSE_ERRORS);
+                rlog -> log(log_prefix + (String) "DeserializationError: " + error.c_str());
+                routeError();
+                return;
+            }
+
+            JsonVariant commandValue = json[PROPERTY_COMMAND];
+            if (commandValue.isNull()) {
+                // Properties without a command modify the actual dice command
+                routeDiceCommand(NO_COMMAND);
+                return;
+            }
+
+            // Both the number and the name of the command are valid
+            if (commandValue.is<int>()) {
+                int commandId = commandValue.as<int>();
+                routeDiceCommand(commandId >= 0 && commandId < DICE_COMMAND_COUNT ? commandId : DICE_COMMAND_ERROR);
+                return;
+            }
+
+            const char* name = commandValue.as<const char*>();
+            const CommandRoute* route = CommandParser::findRoute(name);
+
+            // Numeric string, e.g. "command":"3"
+            int commandId;
+            if (route == NULL && name != NULL && CommandParser::parseInteger(name, strlen(name), commandId)) {
+                routeDiceCommand(commandId >= 0 && commandId < DICE_COMMAND_COUNT ? commandId : DICE_COMMAND_ERROR);
+                return;
+            }
+
+            if (route == NULL) {
+                Metrics::increment(METRIC_PARSE_ERRORS);
+                rlog -> log(log_prefix, (String) "Unknown command: " + name);
+                routeError();
+                return;
+            }
+
+            rlog -> log(log_prefix, (String) "Command received: " + name);
+            switch (route -> owner) {
+                case OWNER_DATABASE:
+                    this -> configCommandArrived -> fire(json.as<JsonObject>());
+                    break;
+                case OWNER_DICE:
+                    routeDiceCommand(route -> id);
+                    break;
+            }
+        }
+
+        // Convert the parsed document to a DiceCommand. commandId is NO_COMMAND if only the properties are set.
+        void routeDiceCommand(int commandId) {
+            DiceCommand command = {};
+
+            if (commandId != NO_COMMAND) {
+                command.command = commandId;
+                command.fields |= DICE_FIELD_COMMAND;
+            }
+
+            int value;
+            if (readInteger(PROPERTY_SPEED, DICE_FIELD_SPEED, value)) {
+                command.speed = value;
+                command.fields |= DICE_FIELD_SPEED;
+            }
+
+            if (readInteger(PROPERTY_COUNT, DICE_FIELD_COUNT, value)) {
+                command.count = value;
+                command.fields |= DICE_FIELD_COUNT;
+            }
+
+            if (json.containsKey(PROPERTY_INFINITY)) {
+                command.infinity = json[PROPERTY_INFINITY].as<bool>();
+                command.fields |= DICE_FIELD_INFINITY;
+            }
+
+            if (json.containsKey(PROPERTY_COLOR)) {
+                if (CommandParser::parseColor(json[PROPERTY_COLOR].as<const char*>(), command.color)) {
+                    command.fields |= DICE_FIELD_COLOR;
+                } else {
+                    rlog -> log(log_prefix, "Color is not valid.");
+                }
+            }
+
+            if (readInteger(PROPERTY_NUMBER, DICE_FIELD_NUMBER, value)) {
+                command.number = value;
+                command.fields |= DICE_FIELD_NUMBER;
+            }
+
+            if (json.containsKey(PROPERTY_BRIGHTNESS)) {
+                command.brightness = constrain(json[PROPERTY_BRIGHTNESS].as<int>(), 0, 255);
+                command.fields |= DICE_FIELD_BRIGHTNESS;
+            }
+
+            this -> diceCommandArrived -> fire(command);
+        }
+
+        // Integer property of the document, false if it is missing or out of the range of its field
+        bool readInteger(const char* property, uint8_t field, int &value) {
+            if (!json.containsKey(property)) {
+                return false;
+            }
+            value = json[property].as<int>();
+            if (!CommandParser::isInRange(field, value)) {
+                rlog -> log(log_prefix, (String) "Value is out of range: " + property + " " + value);
+                return false;
+            }
+            return true;
+        }
+};
+
+#endif
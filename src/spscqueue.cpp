@@ -0,0 +1,54 @@
+#ifndef SPSCQUEUE
+#define SPSCQUEUE
+
+#include <atomic>
+#include <cstddef>
+
+// Lock-free single-producer/single-consumer queue
+// One task may push, and one (other) task may pop without locking.
+// SIZE must be a power of two, one slot is always kept empty.
+template<typename T, size_t SIZE>
+class SpscQueue {
+
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two");
+
+    T items[SIZE];
+    std::atomic<size_t> head; // Next slot to write (producer)
+    std::atomic<size_t> tail; // Next slot to read (consumer)
+
+    public:
+        SpscQueue() : head(0), tail(0) {}
+
+        // Returns false if the queue is full
+        bool push(const T &item) {
+            size_t currentHead = head.load(std::memory_order_relaxed);
+            size_t nextHead = (currentHead + 1) & (SIZE - 1);
+            if (nextHead == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            items[currentHead] = item;
+            head.store(nextHead, std::memory_order_release);
+            return true;
+        }
+
+        // Returns false if the queue is empty
+        bool pop(T &item) {
+            size_t currentTail = tail.load(std::memory_order_relaxed);
+            if (currentTail == head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = items[currentTail];
+            tail.store((currentTail + 1) & (SIZE - 1), std::memory_order_release);
+            return true;
+        }
+
+        bool isEmpty() {
+            return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+        }
+
+        size_t size() {
+            return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)) & (SIZE - 1);
+        }
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef TELEMETRY
+#define TELEMETRY
+
+#include "definitions.h"
+#include <WiFi.h>
+#include <Callback.h>
+#include <esp_heap_caps.h>
+#include "log.cpp"
+#include "utilities.cpp"
+#include "database.cpp"
+#include "metrics.cpp"
+
+// Periodic runtime report of the counters on the telemetry topic (/dice/telemetry)
+// The rates are calculated from the difference of the counters since the last report.
+class Telemetry {
+
+    Log* rlog;
+    String log_prefix = "[TELEMETRY] ";
+    Signal<MQTTMessage>* message;
+    Database* database;
+
+    unsigned long interval = 0; // ms, 0 = disabled
+    unsigned long lastReport = 0;
+    uint32_t lastCommands = 0;
+    uint32_t lastFrames = 0;
+
+    char buffer[TELEMETRY_BUFFER_SIZE];
+
+    public:
+        Telemetry(Log &log) {
+            this -> rlog = &log;
+        }
+
+        void setup(Database &database, Signal<MQTTMessage> &message) {
+            this -> message = &message;
+            this -> database = &database;
+
+            readInterval();
+
+            lastReport = millis();
+            lastCommands = Metrics::get(METRIC_COMMANDS);
+            lastFrames = Metrics::get(METRIC_FRAMES);
+        }
+
+        void receiveConfigChange(uint32_t changes) {
+            if (changes & CONFIG_CHANGED_TELEMETRY) {
+                readInterval();
+            }
+        }
+
+        void loop() {
+            if (interval == 0 || millis() - lastReport < interval) {
+                return;
+            }
+            publish();
+        }
+
+    private:
+        void readInterval() {
+            int seconds = max(database -> getConfig().telemetryInterval, 0);
+            this -> interval = seconds * 1000UL;
+            this -> rlog -> log(log_prefix, (String) "Telemetry interval (s): " + seconds);
+        }
+
+        void publish() {
+            unsigned long now = millis();
+            unsigned long elapsed = now - lastReport;
+            lastReport = now;
+
+            uint32_t commands = Metrics::get(METRIC_COMMANDS);
+            uint32_t frames = Metrics::get(METRIC_FRAMES);
+            float commandRate = (commands - lastCommands) * 1000.0f / elapsed;
+            float frameRate = (frames - lastFrames) * 1000.0f / elapsed;
+            lastCommands = commands;
+            lastFrames = frames;
+
+            uint32_t loopAverage;
+            uint32_t loopMax;
+            Metrics::takeLoopStats(loopAverage, loopMax);
+
+            int rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+
+            snprintf(buffer, sizeof(buffer),
+                "{\"uptime\":%lu,\"loop_avg_us\":%u,\"loop_max_us\":%u,\"heap_free\":%u,\"heap_largest\":%u,\"rssi\":%d,"
+                "\"mqtt_reconnects\":%u,\"mqtt_in\":%u,\"mqtt_out\":%u,\"mqtt_queue_depth\":%u,\"mqtt_queue_high_water\":%u,"
+                "\"mqtt_queue_drops\":%u,\"commands_per_s\":%.1f,\"fps\":%.1f}",
+                now / 1000, (unsigned int) loopAverage, (unsigned int) loopMax, (unsigned int) ESP.getFreeHeap(),
+                (unsigned int) heap_caps_get_largest_free_block(MALLOC_CAP_8BIT), rssi,
+                (unsigned int) Metrics::get(METRIC_MQTT_RECONNECTS), (unsigned int) Metrics::get(METRIC_MQTT_MESSAGES_IN),
+                (unsigned int) Metrics::get(METRIC_MQTT_MESSAGES_OUT), (unsigned int) Metrics::get(GAUGE_MQTT_QUEUE_DEPTH),
+                (unsigned int) Metrics::get(GAUGE_MQTT_QUEUE_HIGH_WATER), (unsigned int) Metrics::get(METRIC_MQTT_QUEUE_DROPS),
+                commandRate, frameRate);
+
+            this -> message -> fire(MQTTMessage {TELEMETRY_TOPIC, buffer, false});
+        }
+};
+
+#endif
@@ -8,4 +8,12 @@ struct MQTTMessage {
   boolean retain;
 };
 
+// Incoming message (MQTT, Bluetooth). The payload is not copied, it points into the buffer of the receiver
+// and it is valid only while the signal is fired. The parser may modify it in place.
+struct RawMessage {
+  char* payload;
+  size_t length;
+  const char* topic; // Topic after the input topic (e.g. "/number"), empty for the input topic itself
+};
+
 #endif
\ No newline at end of file
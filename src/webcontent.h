@@ -1,1497 +1,750 @@
 // This file is autogenerated. DO NOT MODIFY!!!
 
-// /functions.js
-const char* const data_functions_js_path PROGMEM = "/functions.js";
-const char data_functions_js[] PROGMEM = R"=====(
-// Must be a flat json object
-let boardData = {};
-let ajax = {};
-let timer;
-let boardname;
-let resetconfig = false;
-let advancedNetwork = false;
-let rebootCheck;
-let BOARD_NAME = "esp32dev";
-// AJAX service
-ajax.x = function () {
-if (typeof XMLHttpRequest !== 'undefined') {
-return new XMLHttpRequest();
-}
-var versions = [
-"MSXML2.XmlHttp.6.0",
-"MSXML2.XmlHttp.5.0",
-"MSXML2.XmlHttp.4.0",
-"MSXML2.XmlHttp.3.0",
-"MSXML2.XmlHttp.2.0",
-"Microsoft.XmlHttp"
-];
-var xhr;
-for (var i = 0; i < versions.length; i++) {
-try {
-xhr = new ActiveXObject(versions[i]);
-break;
-} catch (e) {
-}
-}
-return xhr;
-};
-ajax.send = function (url, callback, method, data, async) {
-if (async === undefined) {
-async = true;
-}
-var x = ajax.x();
-x.open(method, url, async);
-x.onreadystatechange = function () {
-if (x.readyState == 4) {
-callback(x.responseText, x.status)
-}
-};
-if (method == 'POST') {
-x.setRequestHeader('Content-type', 'application/x-www-form-urlencoded');
-}
-x.send(data)
-};
-ajax.get = function (url, data, callback, async) {
-var query = [];
-for (var key in data) {
-query.push(key + '=' + data[key]);
-}
-ajax.send(url + (query.length ? '?' + query.join('&') : ''), callback, 'GET', null, async)
-};
-ajax.post = function (url, data, callback, async) {
-var query = [];
-for (var key in data) {
-query.push(key + '=' + data[key]);
-}
-ajax.send(url, callback, 'POST', query.join('&'), async)
-};
-// Ajax upload
-// Function that will allow us to know if Ajax uploads are supported
-function supportAjaxUploadWithProgress() {
-return supportFileAPI() && supportAjaxUploadProgressEvents() && supportFormData();
-// Is the File API supported?
-function supportFileAPI() {
-var fi = document.createElement('INPUT');
-fi.type = 'file';
-return 'files' in fi;
-};
-// Are progress events supported?
-function supportAjaxUploadProgressEvents() {
-var xhr = new XMLHttpRequest();
-return !! (xhr && ('upload' in xhr) && ('onprogress' in xhr.upload));
-};
-// Is FormData supported?
-function supportFormData() {
-return !! window.FormData;
-}
-}
-function initFullFormAjaxUpload() {
-var form = document.getElementById('form-id');
-form.onsubmit = function() {
-// FormData receives the whole form
-var formData = new FormData(form);
-// We send the data where the form wanted
-var action = form.getAttribute('action');
-// Code common to both variants
-sendXHRequest(formData, action);
-// Avoid normal form submission
-return false;
-}
-}
-function initFileOnlyAjaxUpload() {
-var uploadBtn = document.getElementById('upload-button-id');
-uploadBtn.onclick = function (evt) {
-var formData = new FormData();
-// Since this is the file only, we send it to a specific location
-var action = '/upgrade';
-// FormData only has the file
-var fileInput = document.getElementById('file-id');
-var file = fileInput.files[0];
-formData.append('our-file', file);
-getItem("custom-file-upload").style.display = "none";
-uploadBtn.style.display = "none";
-// Code common to both variants
-sendXHRequest(formData, action);
-}
-}
-// Once the FormData instance is ready and we know
-// where to send the data, the code is the same
-// for both variants of this technique
-function sendXHRequest(formData, uri) {
-// Get an XMLHttpRequest instance
-var xhr = new XMLHttpRequest();
-// Set up events
-xhr.upload.addEventListener('loadstart', onloadstartHandler, false);
-xhr.upload.addEventListener('progress', onprogressHandler, false);
-xhr.upload.addEventListener('load', onloadHandler, false);
-xhr.addEventListener('readystatechange', onreadystatechangeHandler, false);
-// Set up request
-xhr.open('POST', uri, true);
-// Fire!
-xhr.send(formData);
-}
-// Handle the start of the transmission
-function onloadstartHandler(evt) {
-var div = document.getElementById('upload-status');
-div.innerHTML = 'Upload started.';
-var loader = getItem("loader");
-loader.style.display = "block";
-rebootCheck = setInterval(ping, 60000);
-}
-// Handle the end of the transmission
-function onloadHandler(evt) {
-var div = document.getElementById('upload-status');
-// div.innerHTML += '<' + 'br>File uploaded. Waiting for response.';
-}
-// Handle the progress
-function onprogressHandler(evt) {
-var div = document.getElementById('progress');
-var percent = evt.loaded/evt.total*100;
-// div.innerHTML = 'Progress: ' + percent + '%';
-}
-// Handle the response from the server
-function onreadystatechangeHandler(evt) {
-var status, text, readyState;
-try {
-readyState = evt.target.readyState;
-text = evt.target.responseText;
-status = evt.target.status;
-}
-catch(e) {
-return;
-}
-if (readyState == 4 && status == '200' && evt.target.responseText) {
-var status = document.getElementById('upload-status');
-status.innerHTML += '<' + 'br>Success!';
-// var result = document.getElementById('result');
-// result.innerHTML = '<p>The server saw it as:</p><pre>' + evt.target.responseText + '</pre>';
-}
-}
-// Clock functions
-function clearconfig() {
-if (getItem("reset").checked) {
-resetconfig = true;
-getItem("resetbutton").style.display = 'block';
-getItem("savebutton").style.display = 'none';
-} else {
-resetconfig = false;
-getItem("resetbutton").style.display = 'none';
-getItem("savebutton").style.display = 'block';
-}
-}
-function advanced() {
-if (!advancedNetwork) {
-getItem("networkmore").style.display = 'block';
-getItem("advancednet").style.display = 'none';
-getItem("basicnet").style.display = 'block';
-advancedNetwork = true;
-} else {
-getItem("networkmore").style.display = 'none';
-getItem("advancednet").style.display = 'block';
-getItem("basicnet").style.display = 'none';
-advancedNetwork = false;
-}
-}
-function save(){
-if (resetconfig) {
-boardData = {
-name: boardname
-}
-} else {
-var button = getItem("savebutton");
-var loader = getItem("loader");
-loader.style.display = "block";
-button.style.display = "none";
-clockdata = collectData();
-
-clockdata.name = boardname;
-}
-var json = JSON.stringify(clockdata);
-ajax.post("/savedata", {data : json}, function(){});
-rebootCheck = setInterval(ping, 20000);
-}
-function ping(){
-ajax.get("/", {}, function(response, status){
-if(status == 200) {
-clearInterval(rebootCheck);
-var button = getItem("savebutton");
-var loader = getItem("loader");
-loader.style.display = "none";
-if (button) {
-button.style.display = "block";
-}
-// Reload the page
-window.location.href = "/";
-}
-});
-}
-function collectData (){
-var form = document.getElementById('dataform');
-const values = {};
-const inputs = form.elements;
-for (let i = 0; i < inputs.length; i++) {
-if (inputs[i].name) {
-values[inputs[i].name] = inputs[i].value;
-}
-}
-return values;
-}
-
-function fillData() {
-Object.entries(boardData).forEach(([key, value]) => {
-if (getItem(key)) {
-getItem(key).value = value;
-}
-});
-}
-
-function pad(n) { return ("0" + n).slice(-2); }
-function getItem(id) {
-return document.getElementById(id);
-}
-function getData() {
-ajax.get('/data', {}, function(response) {
-//var response = '{"ssid":"","pw":"","timestamp":"1611008990","ntp":"","timezone":"","dst":false,"name":"24H"}';
-if (response) {
-boardData = JSON.parse(response);
-boardname = boardData.name;
-fillData();
-} else {
-console.log("Response was empty.");
-}
-});
-}
-// Add css slowly to mitigate the network traffic for ESP32
-function loadCSS(cssName){
-document.getElementsByTagName("head")[0].insertAdjacentHTML(
-"beforeend",
-"<link rel=\"stylesheet\" href=\"" + cssName + "\" />");
-}
-// Modal
-var modal = document.getElementById("myModal");
-var btn = document.getElementById("reset");
-var span = document.getElementsByClassName("close")[0];
-if (modal && btn && span) {
-btn.onclick = function() {
-modal.style.display = "block";
-}
-span.onclick = function() {
-modal.style.display = "none";
-}
-window.onclick = function(event) {
-if (event.target == modal) {
-modal.style.display = "none";
-}
-}
-}
-setTimeout(function() {
-if (location.pathname == "/" || location.pathname.includes("features")) {
-getData();
-}
-}, 300);
-setTimeout(function() {
-loadCSS('/normalize.css');
-}, 600);
-setTimeout(function() {
-loadCSS('/skeleton.css');
-}, 900);
-setTimeout(function() {
-loadCSS('/style.css');
-}, 1200);
- // Actually confirm support
- // initialize the ajax upload in the update page
- if (window.location.href.includes("update") && supportAjaxUploadWithProgress()) {
-// Ajax uploads are supported!
-// Change the support message and enable the upload button
-var notice = document.getElementById('support-notice');
-
-// Init the Ajax form submission
-initFullFormAjaxUpload();
-// Init the single-field file upload
-initFileOnlyAjaxUpload();
-}
-function getFile() {
-getItem("file-id").click();
-}
-function getFileName(obj) {
-var file = obj.value;
-var fileName = file.split("\\");
-fileName = fileName[fileName.length - 1];
-document.getElementById("fileinput").innerHTML = fileName;
-var extension = fileName.substr(fileName.length - 4);
-var uploadBtn = document.getElementById('upload-button-id');
-var error = document.getElementById('error');
-// Small verification
-// file name should contains the BOARD_NAME_ string and the extension should be ".bin"
-if (fileName.includes(BOARD_NAME+"_") && extension == ".bin") {
-uploadBtn.removeAttribute('disabled');
-error.style.display = "none";
-} else {
-error.style.display = "block";
-}
-}
-)=====";
-
-// /index.html
-const char* const data_index_html_path PROGMEM = "/index.html";
-const char data_index_html[] PROGMEM = R"=====(
-<!DOCTYPE HTML><html>
-<head>
-<meta http-equiv="Content-Type" content="text/html; charset=utf-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1" />
-<meta http-equiv="Cache-Control" content="no-cache, no-store, must-revalidate" />
-<meta http-equiv="Pragma" content="no-cache" />
-<meta http-equiv="Expires" content="0" />
-<title>Dice - Administration</title>
-</head>
-<body>
-<div id="loadingStart">Loading...</div>
-<div id="main" style="display: none;">
-<div class="loading" id="loader" style="display: none;">
-<div style="margin-left: -25px">Loading...</div>
-<div>&#8230;</div>
-</div>
-<div class="logo">
-Dice
-</div>
-<div id="header">
-<div class="row">
-<h5>Dice</h5>
-</div>
-</div>
-<div id="sidebar">
-<a class="button w100" href="/">home</a>
-<a class="button w100" href="/update">update</a>
-<!--<a class="button w100 button-danger" id="reset" href="#">reset</a>-->
-<div class="version" id="version">v0.01 - 9</div>
-<div id="footer">
-<div><a href="https://github.com/redakker/" target="_blank">redakker</a></div>
-</div>
-</div>
-<div id="content">
-<div class="contaier">
-<!-- The Modal -->
-<div id="myModal" class="modal" style="display: none;">
-<!-- Modal content -->
-<div class="modal-content">
-<span class="close">&times;</span>
-<p>Some text in the Modal..</p>
-</div>
-</div>
-<div class="row">
-<form id="dataform">
-<div class="row" style="position: relative">
-<h5 class="grey hrborder">Network settings</h5>
-<div class="extrafunc pull-right text-warning hand" id="advancednet" onclick="advanced()">advanced +</div>
-<div class="extrafunc pull-right text-warning hand" id="basicnet" style="display: none" onclick="advanced()">basic -</div>
-</div>
-<div class="row">
-<div class="six columns">
-<label for="ssid">WiFi name</label>
-<input type="text" class="u-full-width" name="ssid" id="ssid" placeholder="SSID">
-</div>
-<div class="six columns">
-<label for="pw">Password</label>
-<input type="password" class="u-full-width" name="pw" id="pw" placeholder="Password">
-</div>
-</div>
-<div class="row">
-<div class="six columns">
-<label for="mqttserver">MQTT server</label>
-<input type="text" class="u-full-width" name="mqttserver" id="mqttserver" placeholder="MQTT server address">
-</div>
-<div class="three columns">
-<label for="mqttport">MQTT port</label>
-<input type="text" class="u-full-width" value="1883" name="mqttport" id="mqttport" placeholder="MQTT server mqttport">
-</div>
-<div class="three columns">
-<label for="mqttprefix">Base topic</label>
-<input type="text" class="u-full-width" name="mqttprefix" id="mqttprefix" placeholder="MQTT topic prefix">
-</div>
-</div>
-<div class="row">
-<div class="six columns">
-<label for="mqttuser">Username</label>
-<input type="text" class="u-full-width" name="mqttuser" id="mqttuser" placeholder="Username">
-</div>
-<div class="six columns">
-<label for="mqttpw">Password</label>
-<input type="password" class="u-full-width" name="mqttpw" id="mqttpw" placeholder="Password">
-</div>
-</div>
-<div class="row">
-<label for="reboot">Reboot after (hours)</label>
-<input type="text" class="u-full-width" name="reboot" id="reboot" placeholder="">
-<div class="inputcomment"></div>
-</div>
-<div class="row">
-<label for="detailed">Detailed report</label>
-<select class="u-full-width" name="detailed" id="detailed">
-<option value="0">Do not send</option>
-<option value="1">Send</option>
-</select>
-<div class="inputcomment">Send detailed MQTT report.</div>
-</div>
-<div class="row" style="height: 30px;"></div>
-<input class="button-primary" type="button" value="Submit" id="savebutton" onclick="save()">
-</form>
-</div>
-</div>
-</div>
-<script type="text/javascript" src="/functions.js"></script>
-</div>
-</body>
-</html>
-
-)=====";
+#include <Arduino.h>
 
 // /normalize.css
 const char* const data_normalize_css_path PROGMEM = "/normalize.css";
-const char data_normalize_css[] PROGMEM = R"=====(
-/*! normalize.css v3.0.2 | MIT License | git.io/normalize */
-/**
- * 1. Set default font family to sans-serif.
- * 2. Prevent iOS text size adjust after orientation change, without disabling
- *user zoom.
- */
-html {
-font-family: sans-serif; /* 1 */
--ms-text-size-adjust: 100%; /* 2 */
--webkit-text-size-adjust: 100%; /* 2 */
-}
-/**
- * Remove default margin.
- */
-body {
-margin: 0;
-}
-/* HTML5 display definitions
- ========================================================================== */
-/**
- * Correct `block` display not defined for any HTML5 element in IE 8/9.
- * Correct `block` display not defined for `details` or `summary` in IE 10/11
- * and Firefox.
- * Correct `block` display not defined for `main` in IE 11.
- */
-article,
-aside,
-details,
-figcaption,
-figure,
-footer,
-header,
-hgroup,
-main,
-menu,
-nav,
-section,
-summary {
-display: block;
-}
-/**
- * 1. Correct `inline-block` display not defined in IE 8/9.
- * 2. Normalize vertical alignment of `progress` in Chrome, Firefox, and Opera.
- */
-audio,
-canvas,
-progress,
-video {
-display: inline-block; /* 1 */
-vertical-align: baseline; /* 2 */
-}
-/**
- * Prevent modern browsers from displaying `audio` without controls.
- * Remove excess height in iOS 5 devices.
- */
-audio:not([controls]) {
-display: none;
-height: 0;
-}
-/**
- * Address `[hidden]` styling not present in IE 8/9/10.
- * Hide the `template` element in IE 8/9/11, Safari, and Firefox < 22.
- */
-[hidden],
-template {
-display: none;
-}
-/* Links
- ========================================================================== */
-/**
- * Remove the gray background color from active links in IE 10.
- */
-a {
-background-color: transparent;
-}
-/**
- * Improve readability when focused and also mouse hovered in all browsers.
- */
-a:active,
-a:hover {
-outline: 0;
-}
-/* Text-level semantics
- ========================================================================== */
-/**
- * Address styling not present in IE 8/9/10/11, Safari, and Chrome.
- */
-abbr[title] {
-border-bottom: 1px dotted;
-}
-/**
- * Address style set to `bolder` in Firefox 4+, Safari, and Chrome.
- */
-b,
-strong {
-font-weight: bold;
-}
-/**
- * Address styling not present in Safari and Chrome.
- */
-dfn {
-font-style: italic;
-}
-/**
- * Address variable `h1` font-size and margin within `section` and `article`
- * contexts in Firefox 4+, Safari, and Chrome.
- */
-h1 {
-font-size: 2em;
-margin: 0.67em 0;
-}
-/**
- * Address styling not present in IE 8/9.
- */
-mark {
-background: #ff0;
-color: #000;
-}
-/**
- * Address inconsistent and variable font size in all browsers.
- */
-small {
-font-size: 80%;
-}
-/**
- * Prevent `sub` and `sup` affecting `line-height` in all browsers.
- */
-sub,
-sup {
-font-size: 75%;
-line-height: 0;
-position: relative;
-vertical-align: baseline;
-}
-sup {
-top: -0.5em;
-}
-sub {
-bottom: -0.25em;
-}
-/* Embedded content
- ========================================================================== */
-/**
- * Remove border when inside `a` element in IE 8/9/10.
- */
-img {
-border: 0;
-}
-/**
- * Correct overflow not hidden in IE 9/10/11.
- */
-svg:not(:root) {
-overflow: hidden;
-}
-/* Grouping content
- ========================================================================== */
-/**
- * Address margin not present in IE 8/9 and Safari.
- */
-figure {
-margin: 1em 40px;
-}
-/**
- * Address differences between Firefox and other browsers.
- */
-hr {
--moz-box-sizing: content-box;
-box-sizing: content-box;
-height: 0;
-}
-/**
- * Contain overflow in all browsers.
- */
-pre {
-overflow: auto;
-}
-/**
- * Address odd `em`-unit font size rendering in all browsers.
- */
-code,
-kbd,
-pre,
-samp {
-font-family: monospace, monospace;
-font-size: 1em;
-}
-/* Forms
- ========================================================================== */
-/**
- * Known limitation: by default, Chrome and Safari on OS X allow very limited
- * styling of `select`, unless a `border` property is set.
- */
-/**
- * 1. Correct color not being inherited.
- *Known issue: affects color of disabled elements.
- * 2. Correct font properties not being inherited.
- * 3. Address margins set differently in Firefox 4+, Safari, and Chrome.
- */
-button,
-input,
-optgroup,
-select,
-textarea {
-color: inherit; /* 1 */
-font: inherit; /* 2 */
-margin: 0; /* 3 */
-}
-/**
- * Address `overflow` set to `hidden` in IE 8/9/10/11.
- */
-button {
-overflow: visible;
-}
-/**
- * Address inconsistent `text-transform` inheritance for `button` and `select`.
- * All other form control elements do not inherit `text-transform` values.
- * Correct `button` style inheritance in Firefox, IE 8/9/10/11, and Opera.
- * Correct `select` style inheritance in Firefox.
- */
-button,
-select {
-text-transform: none;
-}
-/**
- * 1. Avoid the WebKit bug in Android 4.0.* where (2) destroys native `audio`
- *and `video` controls.
- * 2. Correct inability to style clickable `input` types in iOS.
- * 3. Improve usability and consistency of cursor style between image-type
- *`input` and others.
- */
-button,
-html input[type="button"], /* 1 */
-input[type="reset"],
-input[type="submit"] {
--webkit-appearance: button; /* 2 */
-cursor: pointer; /* 3 */
-}
-/**
- * Re-set default cursor for disabled elements.
- */
-button[disabled],
-html input[disabled] {
-cursor: default;
-}
-/**
- * Remove inner padding and border in Firefox 4+.
- */
-button::-moz-focus-inner,
-input::-moz-focus-inner {
-border: 0;
-padding: 0;
-}
-/**
- * Address Firefox 4+ setting `line-height` on `input` using `!important` in
- * the UA stylesheet.
- */
-input {
-line-height: normal;
-}
-/**
- * It's recommended that you don't attempt to style these elements.
- * Firefox's implementation doesn't respect box-sizing, padding, or width.
- *
- * 1. Address box sizing set to `content-box` in IE 8/9/10.
- * 2. Remove excess padding in IE 8/9/10.
- */
-input[type="checkbox"],
-input[type="radio"] {
-box-sizing: border-box; /* 1 */
-padding: 0; /* 2 */
-}
-/**
- * Fix the cursor style for Chrome's increment/decrement buttons. For certain
- * `font-size` values of the `input`, it causes the cursor style of the
- * decrement button to change from `default` to `text`.
- */
-input[type="number"]::-webkit-inner-spin-button,
-input[type="number"]::-webkit-outer-spin-button {
-height: auto;
-}
-/**
- * 1. Address `appearance` set to `searchfield` in Safari and Chrome.
- * 2. Address `box-sizing` set to `border-box` in Safari and Chrome
- *(include `-moz` to future-proof).
- */
-input[type="search"] {
--webkit-appearance: textfield; /* 1 */
--moz-box-sizing: content-box;
--webkit-box-sizing: content-box; /* 2 */
-box-sizing: content-box;
-}
-/**
- * Remove inner padding and search cancel button in Safari and Chrome on OS X.
- * Safari (but not Chrome) clips the cancel button when the search input has
- * padding (and `textfield` appearance).
- */
-input[type="search"]::-webkit-search-cancel-button,
-input[type="search"]::-webkit-search-decoration {
--webkit-appearance: none;
-}
-/**
- * Define consistent border, margin, and padding.
- */
-fieldset {
-border: 1px solid #c0c0c0;
-margin: 0 2px;
-padding: 0.35em 0.625em 0.75em;
-}
-/**
- * 1. Correct `color` not being inherited in IE 8/9/10/11.
- * 2. Remove padding so people aren't caught out if they zero out fieldsets.
- */
-legend {
-border: 0; /* 1 */
-padding: 0; /* 2 */
-}
-/**
- * Remove default vertical scrollbar in IE 8/9/10/11.
- */
-textarea {
-overflow: auto;
-}
-/**
- * Don't inherit the `font-weight` (applied by a rule above).
- * NOTE: the default cannot safely be changed in Chrome and Safari on OS X.
- */
-optgroup {
-font-weight: bold;
-}
-/* Tables
- ========================================================================== */
-/**
- * Remove most spacing between table cells.
- */
-table {
-border-collapse: collapse;
-border-spacing: 0;
-}
-td,
-th {
-padding: 0;
-}
-)=====";
+const char* const data_normalize_css_etag PROGMEM = "\"3d79f193f8705427\"";
+const size_t data_normalize_css_len = 2572;
+const uint8_t data_normalize_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xb5,0x59,0x6b,0x8f,0xdb,0xc6,
+0x15,0xfd,0xae,0x5f,0x31,0xb1,0x51,0xd8,0xde,0x52,0x5a,0x69,0x6d,0xc7,0xa9,0xb6,
+0xf9,0x60,0x24,0x76,0x62,0xc4,0x89,0x8b,0xd8,0x45,0x0b,0x18,0x0b,0x70,0x48,0x8e,
+0xa4,0xe9,0x92,0x1c,0x62,0x66,0xa8,0x5d,0xb9,0xed,0x7f,0xef,0xb9,0xf3,0xe0,0x63,
+0x45,0xd9,0x0e,0xd0,0xb5,0x81,0x95,0x96,0x9c,0xb9,0x73,0x5f,0xe7,0xde,0x73,0x67,
+0xcf,0xcf,0xbe,0x61,0xb5,0xd2,0x15,0x2f,0xe5,0x27,0xb1,0xc8,0x8d,0x61,0xfb,0xa7,
+0x8b,0xe5,0xe2,0x82,0xfd,0x87,0xfd,0xfa,0xe6,0x03,0x7b,0x2b,0x73,0x51,0x1b,0x81,
+0xdf,0xb6,0xd2,0x2e,0xa4,0x3a,0xef,0xd6,0xb2,0xb3,0xf3,0xd9,0xf9,0xd9,0xd9,0x8c,
+0x9d,0xb1,0xd5,0x82,0xbd,0x17,0x96,0x15,0x62,0xc3,0xdb,0xd2,0xb2,0x8d,0xaa,0xf1,
+0x83,0x57,0xb2,0x3c,0x30,0xab,0x98,0xe1,0xb5,0x99,0x1b,0xa1,0xe5,0x66,0x41,0x8b,
+0x2f,0x16,0xec,0x6f,0x5a,0xec,0x05,0xd6,0xc8,0x77,0xef,0x99,0x15,0xb7,0x96,0x19,
+0x92,0xc7,0x8b,0x7f,0xb5,0xc6,0x32,0xbe,0xb1,0x42,0x33,0xa5,0x25,0x56,0x70,0x2b,
+0x55,0xcd,0xf2,0x1d,0xaf,0xb7,0x22,0x61,0x37,0xd2,0xee,0x54,0x8b,0x73,0xa4,0xe1,
+0x59,0x29,0xeb,0x2d,0xc4,0xb5,0x10,0xcc,0x3e,0x29,0x55,0x91,0xec,0xf3,0xd9,0xce,
+0x56,0x25,0xfb,0xf7,0x8c,0x34,0x98,0x7b,0x0d,0xd6,0x83,0xf3,0x2f,0xd9,0x39,0x94,
+0xa5,0x75,0xf3,0xca,0xcc,0xe9,0xe4,0x39,0x9d,0x3c,0xf7,0x27,0xaf,0xd9,0x6a,0xb9,
+0xfc,0x93,0x5b,0x73,0xe1,0xd6,0xdc,0x88,0xec,0x5a,0xda,0x2f,0xae,0xfb,0x6f,0x74,
+0xc3,0xef,0xa2,0x52,0x7b,0xd1,0xb9,0xa1,0xe2,0x7a,0x2b,0x6b,0xaf,0x57,0xa6,0x8a,
+0x03,0xf4,0xf2,0x8f,0xd6,0x6c,0x79,0xe9,0x76,0xb1,0x9f,0x3f,0xfc,0xfa,0xf6,0x39,
+0xd9,0xd3,0x94,0xfc,0x40,0x1b,0x65,0x2d,0xc9,0x64,0x33,0x63,0xdf,0xff,0xdf,0xfe,
+0x0d,0x02,0xf5,0x83,0xd2,0x5a,0xe4,0x96,0xa5,0x59,0xa9,0xf2,0xeb,0xb4,0x3b,0xb9,
+0x56,0xd6,0x9f,0x2e,0x0a,0x44,0x4f,0x33,0x5e,0x1f,0x82,0x6e,0xa2,0x14,0x95,0x0b,
+0x55,0xcd,0xde,0xbc,0x62,0xdf,0x9d,0xff,0x65,0xf1,0x47,0xe4,0xa4,0x85,0xb0,0x5c,
+0x96,0x26,0x65,0xf4,0x8b,0x69,0x2b,0x38,0xe0,0x90,0x06,0x61,0xab,0xe5,0xf9,0x6a,
+0x45,0xd2,0x78,0x5d,0xb0,0xd7,0x52,0x8b,0x8d,0xba,0xfd,0x63,0xd2,0x2b,0x2e,0xeb,
+0x4e,0xda,0xca,0x7b,0x9a,0x6b,0x2b,0xf3,0x52,0x24,0x33,0x6e,0x64,0x81,0x8f,0xa0,
+0x41,0x32,0xdb,0xc8,0x6d,0xce,0x1b,0xf2,0xae,0xfb,0xde,0x6a,0xbc,0xdc,0x28,0x85,
+0x64,0x4b,0x66,0x3b,0xc1,0x0b,0xf7,0xb9,0xd5,0xaa,0x6d,0x92,0x19,0x09,0xc6,0x4f,
+0x51,0xb7,0xc9,0xac,0xe6,0xfb,0x64,0x66,0xa0,0x8f,0xdb,0x19,0x6c,0x40,0x2c,0x83,
+0x56,0x6b,0xe6,0xb4,0xbc,0xec,0xd3,0x00,0x68,0xe8,0x2c,0x90,0x35,0xf2,0x54,0xcc,
+0x3f,0x63,0xc8,0xd8,0xb1,0x00,0xc7,0x6f,0x1d,0xc0,0xf6,0x82,0x6c,0xe1,0x25,0xc3,
+0xaf,0xdb,0xda,0x85,0x41,0x6d,0x58,0xda,0x68,0xb5,0xd5,0xc2,0x18,0x67,0xf9,0x0f,
+0x3b,0xad,0x2a,0x60,0x23,0xf8,0x2f,0x71,0xce,0x7c,0xd7,0x08,0xcd,0x83,0x3b,0xda,
+0x42,0xaa,0x64,0x96,0xf3,0x7a,0xcf,0xe1,0x84,0xb8,0x37,0x99,0xed,0xe1,0x1d,0x35,
+0x34,0x63,0xa8,0x6a,0x0f,0x94,0xa8,0xc3,0xdc,0xe9,0x00,0x63,0xb9,0x11,0xb4,0x6e,
+0x22,0xfd,0x23,0xaa,0x2b,0x05,0x5f,0xd6,0x2c,0xd3,0xea,0x06,0xa8,0x33,0x6c,0x03,
+0x0d,0xa3,0xe9,0x00,0x2d,0x4b,0x9d,0x4e,0x69,0x07,0xe7,0x1c,0x60,0xd5,0xaa,0x34,
+0x8b,0x01,0x86,0xc4,0x6d,0x0e,0x2d,0xd9,0x4e,0xc8,0xed,0xce,0x25,0x1f,0x95,0x0a,
+0x20,0x45,0xec,0x51,0x8f,0xcc,0xc0,0xb4,0x35,0x7c,0xf9,0xf8,0x63,0x14,0x71,0xf5,
+0x64,0x68,0x51,0xad,0xa0,0xe7,0xcc,0xcb,0xe8,0x30,0xe7,0x54,0x7d,0x59,0x14,0xe4,
+0x05,0x96,0x7e,0xdc,0xc9,0xa2,0x10,0xf5,0x55,0xca,0x8c,0x3d,0x50,0x49,0x71,0xb1,
+0x69,0xf0,0x72,0x94,0xf4,0xe7,0xab,0xa5,0xd3,0xee,0x67,0x38,0x8d,0xd9,0x9d,0x60,
+0xa9,0x15,0x15,0x0e,0xb1,0x22,0x3d,0x46,0x08,0xb2,0x3a,0x61,0xef,0xf9,0x86,0x6b,
+0x99,0x0c,0x73,0x9b,0xfd,0x95,0x5d,0x5c,0x78,0xd5,0xe3,0xb1,0xc9,0x2c,0xca,0x39,
+0xd6,0xdb,0x15,0x88,0xb7,0xb2,0xbe,0xbe,0xaf,0x62,0x10,0x5c,0x4d,0xe6,0x6c,0x35,
+0xb2,0x32,0xe3,0xf9,0x35,0xe5,0x3f,0x34,0xce,0x55,0x09,0x7c,0xb9,0xc0,0x71,0x24,
+0x3e,0x56,0x95,0xa4,0x48,0x07,0xdc,0x10,0x00,0x28,0xdd,0x6f,0x9a,0xbb,0x4d,0x6b,
+0x66,0x35,0xea,0x6d,0xc3,0x35,0x7c,0x32,0xf0,0xf8,0x9b,0x0a,0xa9,0x07,0x39,0x1a,
+0x48,0xe3,0x99,0x2c,0xa5,0x3d,0xb0,0x9b,0x9d,0xa8,0x01,0xe4,0x1c,0x35,0xbc,0x70,
+0x8e,0xe2,0xa5,0x51,0x48,0x1f,0xfc,0xce,0x76,0x58,0xac,0x3d,0x3c,0x78,0x59,0x76,
+0xc9,0x14,0x0e,0x5e,0x7b,0xad,0x00,0xf2,0xb5,0x5b,0x08,0x45,0x90,0x49,0x94,0x97,
+0x7d,0x6d,0xfd,0x40,0x65,0xbb,0x44,0x4a,0x96,0xcc,0x88,0x8a,0xd7,0x48,0xe3,0xfb,
+0xf2,0x64,0x4c,0xa7,0x2f,0xe5,0xd0,0x51,0x66,0x78,0xf4,0x06,0xa3,0xb2,0x4c,0x7f,
+0xb4,0xd2,0x96,0xe2,0x8a,0xfc,0xaa,0x34,0x50,0x34,0xcf,0x94,0xb5,0xaa,0x42,0xc7,
+0x69,0x6e,0x59,0x81,0xef,0xa2,0x98,0xc8,0x62,0x3a,0x56,0xc0,0x48,0x4b,0xdd,0x36,
+0xcd,0x54,0x89,0x9d,0xae,0x38,0xc4,0xc4,0x7b,0xf6,0xe7,0xd3,0xc7,0x66,0xa8,0x69,
+0xc0,0x0e,0xb4,0x0e,0x6d,0xf3,0x26,0xe0,0x85,0xe4,0x9c,0x38,0x6c,0xc2,0x46,0x2f,
+0xfe,0x48,0x7a,0xb1,0xa9,0xa3,0x5c,0xa7,0x25,0xca,0x8c,0x45,0x25,0xc9,0x27,0x04,
+0xef,0xb1,0x1f,0x6d,0x1d,0xd8,0xda,0xad,0x52,0xe6,0xb7,0x38,0x5a,0x00,0x91,0xbe,
+0x6f,0xba,0x8a,0x81,0x8f,0x34,0x54,0xe3,0xd4,0xbd,0x4b,0x43,0xc5,0x4f,0x49,0x18,
+0x15,0x02,0xc4,0xdd,0x7c,0xad,0xf5,0xbb,0x55,0xa7,0x1e,0xce,0x5a,0xb3,0x0b,0x51,
+0x5d,0xf6,0x5d,0x7a,0xf1,0xed,0x0b,0x51,0x4d,0x16,0x8e,0xcf,0x46,0xda,0x8b,0x86,
+0x94,0xeb,0x11,0x40,0xd6,0xec,0xe1,0x66,0x03,0x61,0x01,0x27,0x0f,0x97,0xcb,0x29,
+0xc9,0xb2,0x86,0x0d,0x46,0x1a,0x4b,0x22,0x49,0xdd,0xce,0x2f,0x8e,0x56,0x39,0x97,
+0x4c,0x82,0xc2,0x54,0xf4,0x6c,0x64,0xcd,0x77,0xa0,0x29,0xc7,0xf5,0x19,0x7d,0x38,
+0x0b,0xae,0x33,0x6d,0x83,0x6f,0x9b,0x0d,0xf9,0x93,0x2a,0xb3,0xeb,0x00,0xbe,0x60,
+0xa6,0x27,0x4e,0x69,0x29,0x61,0xda,0x66,0x7c,0xd0,0x8b,0xe7,0x38,0x68,0xb0,0xd9,
+0xa1,0xb0,0x51,0xc6,0x91,0x99,0x35,0x40,0x8f,0x12,0x07,0xbc,0x5e,0x9e,0x6e,0x27,
+0x50,0xd3,0x4b,0xb5,0xaa,0x59,0xb3,0xf9,0x72,0xf1,0x9c,0x22,0x41,0x0f,0x33,0x87,
+0x06,0x0f,0x03,0x3c,0xbf,0x08,0x2f,0x80,0xf0,0x57,0x55,0x26,0x50,0x46,0x0b,0x1f,
+0xf5,0xda,0xde,0x6f,0x9d,0xf4,0x88,0xf4,0x45,0x4b,0xd6,0x44,0x2e,0x90,0x7a,0x93,
+0xe5,0x3f,0x94,0x47,0x59,0x6d,0x3b,0x20,0x8f,0xdb,0x4f,0xa4,0x07,0x54,0xba,0x36,
+0xa5,0xba,0x71,0x69,0xe4,0x5b,0x42,0x90,0x13,0xaa,0x45,0xf0,0xf9,0x7e,0xeb,0xda,
+0xdc,0x5a,0x83,0xae,0x50,0x87,0x8b,0xfb,0xd6,0x61,0x53,0xf0,0xc7,0x4f,0x44,0x5e,
+0x28,0x8e,0xf7,0xeb,0x8f,0x98,0xa9,0x01,0x94,0x93,0x10,0x70,0xe9,0xe5,0x41,0xe7,
+0x6d,0xf0,0x8c,0x6b,0x40,0x81,0x57,0x40,0xd6,0xb3,0x65,0x73,0x3b,0x01,0x81,0x42,
+0x22,0x23,0xd1,0x3f,0xd0,0xe9,0x59,0x26,0xec,0x8d,0x10,0x3d,0x98,0x49,0xae,0x42,
+0xcb,0xd2,0x77,0xf2,0x72,0x47,0x3d,0x60,0x5e,0xa9,0x4f,0x28,0x99,0xb7,0x94,0x95,
+0xf0,0xc3,0x3a,0x3a,0x82,0x9e,0x5d,0xce,0x4e,0xbe,0x98,0x62,0x08,0x3f,0x60,0x01,
+0x48,0x60,0x1f,0xa2,0x49,0x34,0x34,0xce,0xa4,0x3e,0x1c,0xbc,0xb5,0x6a,0xc2,0x20,
+0x55,0x00,0x6b,0xa2,0x4a,0xe7,0x2d,0xe8,0xfd,0x00,0xc7,0xb0,0x11,0xb9,0x41,0x11,
+0x9b,0x94,0x9e,0x2b,0x22,0xb0,0xd7,0x59,0x41,0xbc,0x0d,0xdf,0x0c,0xaf,0x9a,0xbb,
+0xc3,0x4d,0xa5,0x6a,0x85,0x6e,0x9b,0x83,0x02,0x76,0x5f,0x2f,0x87,0xd0,0x5c,0x75,
+0x70,0x79,0x0d,0x62,0x79,0x5f,0x1d,0xf0,0x97,0x5a,0xdd,0xd4,0x20,0x09,0x95,0xf4,
+0x33,0x1b,0x90,0x7d,0x88,0x83,0x50,0x12,0x2a,0xee,0x20,0x27,0x18,0xa6,0x3a,0x10,
+0xba,0x7f,0x92,0xd1,0xf0,0x2d,0xfc,0x77,0xf0,0x9b,0x45,0x41,0xd2,0x62,0x75,0x25,
+0xb6,0x8b,0xfa,0x00,0xa8,0xa4,0x09,0x6b,0xeb,0x92,0x7c,0xc9,0xa9,0xc3,0x69,0xd7,
+0xe1,0xc0,0x28,0x40,0x74,0x41,0x24,0xa4,0xa1,0xee,0xe7,0x9d,0x76,0x4c,0xc2,0x3d,
+0x99,0xa1,0x34,0xcd,0x84,0xf7,0x35,0xd2,0x87,0x8e,0xa2,0x0d,0x5e,0x71,0x69,0x4c,
+0x0b,0x5f,0xf9,0x4a,0x68,0xc2,0x0e,0x9c,0xee,0x27,0x4d,0x54,0x98,0x80,0x72,0x13,
+0x49,0x7a,0x94,0xed,0x62,0x19,0xf4,0x90,0x48,0xd7,0x13,0xa7,0xb0,0xa7,0x8b,0x3b,
+0xb0,0x71,0x1a,0x77,0x99,0x6e,0x31,0x29,0x7f,0x6d,0xbf,0x6e,0x51,0x0a,0x31,0x88,
+0xc8,0xba,0x69,0x6d,0x32,0x53,0x8d,0x0d,0x33,0x8b,0x77,0x14,0x31,0xca,0x5b,0x0b,
+0xf6,0x45,0xe4,0x2c,0x74,0x9a,0xa0,0x4a,0x4f,0xea,0x49,0xeb,0xf1,0xe3,0x8b,0xd0,
+0xb1,0xc2,0x74,0x4a,0x8f,0x9e,0x8e,0xc8,0x7d,0xc7,0x98,0x63,0xb2,0xa7,0x1d,0xe1,
+0xf0,0x35,0x28,0xbd,0xcb,0x74,0x86,0xea,0x8e,0x40,0xb2,0x97,0x46,0xc2,0xa9,0x5f,
+0xea,0x7d,0xa9,0x9b,0xbb,0x1d,0x9b,0xc4,0xb0,0x57,0xa5,0x51,0x5f,0x8e,0xba,0xe0,
+0xc7,0x3f,0x2f,0x3b,0xb6,0x32,0x9f,0x27,0xce,0xdb,0x2f,0x01,0x25,0x5f,0x24,0x68,
+0x67,0x1c,0x30,0xba,0x20,0x82,0x49,0xb9,0x40,0x05,0x81,0xc7,0x27,0xed,0x79,0xd9,
+0xfa,0x29,0x63,0x30,0x8b,0x86,0xc3,0x3c,0xd9,0x1a,0xea,0xd2,0x07,0x2e,0xb9,0x43,
+0xf5,0x46,0xb3,0x58,0x2f,0x2a,0xa8,0xfa,0x59,0x51,0xe3,0x60,0xfb,0x1d,0xd4,0x1d,
+0x47,0x9a,0x0e,0x47,0x85,0x98,0xf5,0x2f,0xf7,0x4a,0x16,0x8e,0xd4,0xff,0x43,0x64,
+0xbf,0xc0,0xba,0xac,0x75,0xe5,0xe5,0x65,0x5d,0x68,0x7a,0xf3,0x6c,0xb1,0x5c,0x9c,
+0x51,0x17,0x43,0xe9,0x7a,0x7c,0xf1,0x04,0x20,0x25,0xfa,0x77,0x40,0xea,0xba,0x16,
+0x1d,0xa7,0x33,0x48,0x73,0x6e,0x75,0x63,0x62,0x3a,0x9e,0xd1,0x06,0xf9,0x2f,0xeb,
+0x48,0xe6,0xe9,0xa2,0xc7,0xd9,0x93,0x83,0xde,0x5d,0x7b,0x22,0xe7,0x72,0x34,0x65,
+0xf6,0xd0,0x08,0x13,0x86,0xb8,0x88,0x86,0x38,0x0f,0xb4,0x26,0x0a,0xe0,0x6e,0xee,
+0x08,0xe1,0xcf,0x0f,0x04,0xbf,0xbc,0xd5,0x06,0x81,0xf6,0x72,0x63,0x27,0x90,0x15,
+0xdf,0x8a,0x39,0xc9,0x84,0xa8,0x78,0x44,0xd7,0x16,0xcc,0xd8,0x71,0xee,0x3e,0xc8,
+0xad,0xf9,0x48,0x3b,0xbe,0x7f,0xe0,0x5f,0x3c,0xb8,0x4a,0x3a,0x30,0x0c,0xdf,0x52,
+0x1b,0xb3,0x78,0x39,0x7a,0x08,0x0a,0x82,0xca,0xf4,0x80,0x58,0x79,0xbc,0x12,0xe2,
+0x4d,0x23,0xb8,0xa6,0x90,0xa1,0xd0,0x39,0x89,0x3d,0x8a,0xbc,0xd2,0x6b,0xd6,0x28,
+0x89,0x1e,0xa3,0x27,0xb0,0xf4,0xbb,0x98,0x9b,0xc1,0x75,0x59,0xb0,0x92,0x52,0x7a,
+0xb2,0xde,0x44,0x6b,0x3e,0xc6,0xb7,0x57,0x23,0xbb,0xba,0xa7,0x04,0xf8,0x70,0x76,
+0x10,0x7d,0x79,0x74,0x37,0x25,0xeb,0x1a,0xa8,0x68,0x78,0x51,0x50,0x8d,0x22,0xaf,
+0x05,0x5a,0x33,0xaa,0x3e,0xc3,0x53,0xd7,0x6b,0xd7,0x55,0xdd,0x98,0x36,0x77,0xdb,
+0x83,0x77,0x8e,0x5f,0x8c,0xd9,0x4e,0x38,0x64,0x7a,0xf0,0xee,0xcf,0xa2,0x32,0x32,
+0x41,0x3e,0x51,0x33,0x62,0x6c,0x5b,0xe3,0x5e,0x7f,0x23,0xab,0x46,0x69,0xe0,0xc4,
+0x51,0x53,0x12,0x46,0x49,0xfe,0xf7,0x97,0x3e,0x3d,0xcc,0x4e,0xc4,0x0e,0xe0,0xb6,
+0x41,0x97,0x11,0x1f,0xf5,0xd7,0x96,0xc3,0x81,0xd4,0x3e,0x32,0x68,0xc0,0xb9,0xaa,
+0x2a,0xea,0xc2,0x04,0x19,0x6e,0xd9,0x41,0xb5,0xa8,0x0e,0xf5,0x23,0x50,0x6f,0x4b,
+0xa3,0xb9,0xed,0xf3,0x1a,0xa7,0x61,0x2e,0x1d,0x35,0x82,0x60,0x05,0x04,0x41,0x37,
+0xff,0xc2,0xdf,0x58,0x16,0x4a,0x18,0x12,0x02,0x5b,0x1b,0x82,0x49,0x4f,0x3d,0x92,
+0xe8,0xfc,0x84,0xae,0xc4,0x6e,0x64,0x61,0x77,0x24,0x2a,0x82,0x37,0xb8,0x07,0xeb,
+0x99,0x5f,0xdf,0x55,0xd9,0x01,0x63,0x49,0x8f,0x2f,0x26,0x00,0xc9,0xf1,0xcd,0x49,
+0x0c,0xf1,0x04,0x2d,0x1d,0xa4,0x76,0xbe,0x13,0xf9,0x35,0x24,0xde,0x4d,0x79,0xcd,
+0x51,0x03,0x1e,0xf8,0x39,0xb4,0x27,0x4d,0xdd,0x4c,0x7a,0xdb,0xb7,0x92,0x41,0x94,
+0x8f,0x6f,0x84,0x5e,0xcb,0x5b,0x17,0xa4,0x11,0x8e,0x29,0xcf,0x7d,0x43,0x7b,0xe4,
+0x2a,0xbe,0x76,0x7e,0x3b,0x2f,0x44,0xf8,0x16,0x00,0x65,0x16,0x44,0x58,0x58,0x8e,
+0xc6,0xca,0x7d,0xb8,0xd3,0x8e,0xd5,0xc4,0x0a,0x4d,0x35,0xc2,0xdd,0xc6,0xf8,0x4c,
+0x49,0x30,0x5c,0xb2,0x9c,0xb7,0x06,0x6f,0x8e,0x8e,0xf5,0x4b,0x49,0xce,0xdd,0x93,
+0xc8,0xbd,0xfe,0x8a,0xd9,0xdf,0x78,0xa4,0x01,0x3d,0xa9,0xf3,0x3b,0x55,0xdc,0xf4,
+0xd8,0x73,0x75,0x8b,0xe1,0x43,0x3f,0xb8,0x02,0x0a,0x42,0x4d,0x70,0x10,0x98,0x1b,
+0x10,0xf0,0xf9,0xa8,0x47,0x9f,0xdc,0xa0,0x5a,0x3b,0xde,0x00,0x77,0xc7,0x74,0xbd,
+0x43,0x24,0x07,0xa9,0x91,0xf6,0xb5,0xa7,0x6f,0xc1,0x06,0x4f,0xf2,0xdd,0x46,0x8a,
+0xb2,0x48,0x4f,0x4e,0xe3,0x94,0x24,0x9d,0x94,0x3e,0xae,0xe9,0xe0,0xe6,0x20,0xc6,
+0x77,0x5a,0x08,0x64,0x3c,0x46,0xc0,0xca,0x96,0x46,0x1f,0x02,0xbf,0xf3,0xd0,0xa6,
+0xb5,0x60,0xf6,0x73,0x94,0x73,0xb5,0x79,0x72,0xec,0x28,0xaf,0xda,0xc9,0xea,0x49,
+0xee,0x75,0x7a,0x0f,0xef,0xe6,0x3f,0xc7,0xe2,0xa3,0x90,0x53,0x0b,0xba,0x2c,0x3c,
+0x29,0xe1,0xcb,0x35,0xd1,0xeb,0x8c,0x54,0x82,0x8a,0x65,0xcc,0x92,0x29,0x8f,0x44,
+0x1e,0xeb,0xdc,0x1b,0xde,0x3e,0xc6,0x7a,0x47,0x2f,0xfc,0x92,0x27,0xd4,0x10,0x9b,
+0x90,0x90,0x23,0x81,0x6e,0x92,0xa4,0xc7,0xe1,0x38,0x5f,0xb7,0x76,0xdc,0x90,0xb0,
+0xa8,0xce,0x63,0xd7,0x85,0x3b,0x2f,0xa1,0xd3,0x75,0xce,0xfb,0x8c,0xb3,0xfb,0x24,
+0xf3,0x4f,0xe6,0xfe,0xe4,0xc9,0xc4,0x3c,0xb9,0x07,0x38,0x51,0xda,0xd7,0xb3,0xe9,
+0xd8,0xdd,0x21,0x1f,0x3f,0xba,0x1b,0x6d,0x36,0xa0,0x70,0x3e,0xa1,0x92,0x40,0x79,
+0x3d,0x1f,0x0a,0x86,0xc5,0xa9,0x10,0x36,0x51,0xfa,0xf5,0x9d,0x83,0x6e,0xba,0x8c,
+0x2a,0xc1,0x54,0x1e,0xe6,0x4b,0xfa,0x3f,0xb8,0x8f,0x61,0x17,0x34,0x2f,0xf6,0x25,
+0x67,0xf1,0xf4,0x39,0xdd,0xcf,0x2c,0xbe,0xbd,0xf0,0x9f,0x2f,0xba,0xbb,0x81,0xa3,
+0x8b,0x78,0x47,0x85,0xd3,0x29,0x7e,0x3e,0xc5,0x5b,0x07,0xf5,0x34,0x06,0xc2,0x28,
+0xd6,0x08,0x85,0x2a,0xcf,0xe8,0x6a,0xf3,0x91,0x2b,0x34,0x74,0x37,0x4d,0x37,0xd8,
+0xd2,0xd5,0x96,0x03,0xfb,0x24,0xb4,0x72,0x0f,0xa2,0x5d,0xa1,0x7f,0x97,0x62,0x8b,
+0x1e,0x33,0x6a,0x8f,0x5f,0x57,0x40,0xef,0xfc,0x45,0xa9,0xfb,0x83,0x80,0xc9,0x41,
+0xc6,0xca,0x8c,0xeb,0x69,0xd2,0x3d,0x18,0x01,0x4e,0xce,0xa6,0x3f,0xba,0x2e,0x17,
+0x29,0xb0,0xab,0xa2,0x83,0xeb,0xbf,0x14,0x89,0xd7,0x34,0xa5,0x84,0x7b,0x30,0xc8,
+0x71,0xa6,0x5b,0x32,0x3c,0x83,0x34,0x97,0x75,0xec,0xb7,0x77,0x1f,0x5e,0xad,0xdd,
+0xae,0x8e,0xc5,0xf0,0x9a,0x9c,0x6b,0xf8,0x46,0x60,0x98,0xc9,0x44,0x28,0xa9,0x45,
+0xff,0x47,0x8a,0x89,0xf9,0xcf,0xab,0x1b,0x67,0x98,0xd3,0x37,0x90,0xec,0x03,0x51,
+0x9c,0x7b,0xbe,0x08,0xaf,0x94,0x81,0xfe,0x18,0xa0,0x29,0xdc,0x91,0x6d,0x5a,0xc7,
+0x64,0x81,0x9d,0x32,0xc4,0xd2,0x3f,0xe8,0x2e,0x68,0x91,0x57,0x25,0x6f,0x8c,0xa0,
+0x1a,0xe3,0xbf,0x5d,0xc6,0x57,0x41,0x54,0x20,0x40,0x16,0x53,0xbc,0xdd,0x61,0xe3,
+0x88,0x17,0xfd,0x0f,0x96,0xbf,0x38,0xd4,0x7e,0x1d,0x00,0x00
+};
 
 // /skeleton.css
 const char* const data_skeleton_css_path PROGMEM = "/skeleton.css";
-const char data_skeleton_css[] PROGMEM = R"=====(
-.container {
-position: relative;
-width: 100%;
-max-width: 960px;
-margin: 0 auto;
-padding: 0 20px;
-box-sizing: border-box; }
-.column,
-.columns {
-width: 100%;
-float: left;
-box-sizing: border-box; }
-
-@media (min-width: 400px) {
-.container {
-width: 85%;
-padding: 0; }
-}
-
-@media (min-width: 550px) {
-.container {
-width: 80%; }
-.column,
-.columns {
-margin-left: 4%; }
-.column:first-child,
-.columns:first-child {
-margin-left: 0; }
-.one.column,
-.one.columns{ width: 4.66666666667%; }
-.two.columns{ width: 13.3333333333%; }
-.three.columns{ width: 22%;}
-.four.columns { width: 30.6666666667%; }
-.five.columns { width: 39.3333333333%; }
-.six.columns{ width: 48%;}
-.seven.columns{ width: 56.6666666667%; }
-.eight.columns{ width: 65.3333333333%; }
-.nine.columns { width: 74.0%;}
-.ten.columns{ width: 82.6666666667%; }
-.eleven.columns { width: 91.3333333333%; }
-.twelve.columns { width: 100%; margin-left: 0; }
-.one-third.column { width: 30.6666666667%; }
-.two-thirds.column{ width: 65.3333333333%; }
-.one-half.column{ width: 48%; }
-
-.offset-by-one.column,
-.offset-by-one.columns{ margin-left: 8.66666666667%; }
-.offset-by-two.column,
-.offset-by-two.columns{ margin-left: 17.3333333333%; }
-.offset-by-three.column,
-.offset-by-three.columns{ margin-left: 26%;}
-.offset-by-four.column,
-.offset-by-four.columns { margin-left: 34.6666666667%; }
-.offset-by-five.column,
-.offset-by-five.columns { margin-left: 43.3333333333%; }
-.offset-by-six.column,
-.offset-by-six.columns{ margin-left: 52%;}
-.offset-by-seven.column,
-.offset-by-seven.columns{ margin-left: 60.6666666667%; }
-.offset-by-eight.column,
-.offset-by-eight.columns{ margin-left: 69.3333333333%; }
-.offset-by-nine.column,
-.offset-by-nine.columns { margin-left: 78.0%;}
-.offset-by-ten.column,
-.offset-by-ten.columns{ margin-left: 86.6666666667%; }
-.offset-by-eleven.column,
-.offset-by-eleven.columns { margin-left: 95.3333333333%; }
-.offset-by-one-third.column,
-.offset-by-one-third.columns{ margin-left: 34.6666666667%; }
-.offset-by-two-thirds.column,
-.offset-by-two-thirds.columns { margin-left: 69.3333333333%; }
-.offset-by-one-half.column,
-.offset-by-one-half.columns { margin-left: 52%; }
-}
-
-
-html {
-font-size: 62.5%; }
-body {
-font-size: 1.5em; 
-line-height: 1.6;
-font-weight: 400;
-font-family: "Raleway", "HelveticaNeue", "Helvetica Neue", Helvetica, Arial, sans-serif;
-color: #222; }
-
-h1, h2, h3, h4, h5, h6 {
-margin-top: 0;
-margin-bottom: 2rem;
-font-weight: 300; }
-h1 { font-size: 4.0rem; line-height: 1.2;letter-spacing: -.1rem;}
-h2 { font-size: 3.6rem; line-height: 1.25; letter-spacing: -.1rem; }
-h3 { font-size: 3.0rem; line-height: 1.3;letter-spacing: -.1rem; }
-h4 { font-size: 2.4rem; line-height: 1.35; letter-spacing: -.08rem; }
-h5 { font-size: 1.8rem; line-height: 1.5;letter-spacing: -.05rem; }
-h6 { font-size: 1.5rem; line-height: 1.6;letter-spacing: 0; }
-
-@media (min-width: 550px) {
-h1 { font-size: 5.0rem; }
-h2 { font-size: 4.2rem; }
-h3 { font-size: 3.6rem; }
-h4 { font-size: 3.0rem; }
-h5 { font-size: 2.4rem; }
-h6 { font-size: 1.5rem; }
-}
-p {
-margin-top: 0; }
-
-a {
-color: #1EAEDB; }
-a:hover {
-color: #0FA0CE; }
-
-.button,
-button,
-input[type="submit"],
-input[type="reset"],
-input[type="button"] {
-display: inline-block;
-height: 38px;
-padding: 0 5px;
-color: #555;
-text-align: center;
-font-size: 11px;
-font-weight: 600;
-line-height: 38px;
-letter-spacing: .1rem;
-text-transform: uppercase;
-text-decoration: none;
-white-space: nowrap;
-background-color: transparent;
-border-radius: 4px;
-border: 1px solid #bbb;
-cursor: pointer;
-box-sizing: border-box; }
-.button:hover,
-button:hover,
-input[type="submit"]:hover,
-input[type="reset"]:hover,
-input[type="button"]:hover,
-.button:focus,
-button:focus,
-input[type="submit"]:focus,
-input[type="reset"]:focus,
-input[type="button"]:focus {
-color: #333;
-border-color: #888;
-outline: 0; }
-.button.button-primary,
-button.button-primary,
-input[type="submit"].button-primary,
-input[type="reset"].button-primary,
-input[type="button"].button-primary {
-color: #FFF;
-background-color: #33C3F0;
-border-color: #33C3F0; }
-.button.button-primary:hover,
-button.button-primary:hover,
-input[type="submit"].button-primary:hover,
-input[type="reset"].button-primary:hover,
-input[type="button"].button-primary:hover,
-.button.button-primary:focus,
-button.button-primary:focus,
-input[type="submit"].button-primary:focus,
-input[type="reset"].button-primary:focus,
-input[type="button"].button-primary:focus {
-color: #FFF;
-background-color: #1EAEDB;
-border-color: #1EAEDB; }
-.button.button-warning,
-button.button-warning,
-input[type="submit"].button-warning,
-input[type="reset"].button-warning,
-input[type="button"].button-warning {
-color: #FFF;
-background-color: #f09e33;
-border-color: #f09e33; }
-.button.button-warning:hover,
-button.button-warning:hover,
-input[type="submit"].button-warning:hover,
-input[type="reset"].button-warning:hover,
-input[type="button"].button-warning:hover,
-.button.button-warning:focus,
-button.button-warning:focus,
-input[type="submit"].button-warning:focus,
-input[type="reset"].button-warning:focus,
-input[type="button"].button-warning:focus {
-color: #FFF;
-background-color: #f09e33;
-border-color: #f09e33; }
-.button.button-danger,
-button.button-danger,
-input[type="submit"].button-danger,
-input[type="reset"].button-danger,
-input[type="button"].button-danger {
-color: #FFF;
-background-color: #c74f4f;
-border-color: #c74f4f; }
-.button.button-danger:hover,
-button.button-danger:hover,
-input[type="submit"].button-danger:hover,
-input[type="reset"].button-danger:hover,
-input[type="button"].button-danger:hover,
-.button.button-danger:focus,
-button.button-danger:focus,
-input[type="submit"].button-danger:focus,
-input[type="reset"].button-danger:focus,
-input[type="button"].button-danger:focus {
-color: #FFF;
-background-color: #c74f4f;
-border-color: #c74f4f; }
-
-input[type="email"],
-input[type="number"],
-input[type="search"],
-input[type="text"],
-input[type="tel"],
-input[type="url"],
-input[type="password"],
-textarea,
-select {
-height: 38px;
-padding: 6px 10px; 
-background-color: #fff;
-border: 1px solid #D1D1D1;
-border-radius: 4px;
-box-shadow: none;
-box-sizing: border-box; }
-input[type="email"],
-input[type="number"],
-input[type="search"],
-input[type="text"],
-input[type="tel"],
-input[type="url"],
-input[type="password"],
-textarea {
--webkit-appearance: none;
- -moz-appearance: none;
-appearance: none; }
-textarea {
-min-height: 65px;
-padding-top: 6px;
-padding-bottom: 6px; }
-input[type="email"]:focus,
-input[type="number"]:focus,
-input[type="search"]:focus,
-input[type="text"]:focus,
-input[type="tel"]:focus,
-input[type="url"]:focus,
-input[type="password"]:focus,
-textarea:focus,
-select:focus {
-border: 1px solid #33C3F0;
-outline: 0; }
-label,
-legend {
-display: block;
-margin-bottom: .5rem;
-font-weight: 600; }
-fieldset {
-padding: 0;
-border-width: 0; }
-input[type="checkbox"],
-input[type="radio"] {
-display: inline; }
-label > .label-body {
-display: inline-block;
-margin-left: .5rem;
-font-weight: normal; }
-
-ul {
-list-style: circle inside; }
-ol {
-list-style: decimal inside; }
-ol, ul {
-padding-left: 0;
-margin-top: 0; }
-ul ul,
-ul ol,
-ol ol,
-ol ul {
-margin: 1.5rem 0 1.5rem 3rem;
-font-size: 90%; }
-li {
-margin-bottom: 1rem; }
-
-code {
-padding: .2rem .5rem;
-margin: 0 .2rem;
-font-size: 90%;
-white-space: nowrap;
-background: #F1F1F1;
-border: 1px solid #E1E1E1;
-border-radius: 4px; }
-pre > code {
-display: block;
-padding: 1rem 1.5rem;
-white-space: pre; }
-
-th,
-td {
-padding: 12px 15px;
-text-align: left;
-border-bottom: 1px solid #E1E1E1; }
-th:first-child,
-td:first-child {
-padding-left: 0; }
-th:last-child,
-td:last-child {
-padding-right: 0; }
-
-button,
-.button {
-margin-bottom: 1rem; }
-input,
-textarea,
-select,
-fieldset {
-margin-bottom: 1.5rem; }
-pre,
-blockquote,
-dl,
-figure,
-table,
-p,
-ul,
-ol,
-form {
-margin-bottom: 2.5rem; }
-
-.u-full-width {
-width: 100%;
-box-sizing: border-box; }
-.u-max-full-width {
-max-width: 100%;
-box-sizing: border-box; }
-.u-pull-right {
-float: right; }
-.u-pull-left {
-float: left; }
-
-hr {
-margin-top: 3rem;
-margin-bottom: 3.5rem;
-border-width: 0;
-border-top: 1px solid #E1E1E1; }
-
-
-.container:after,
-.row:after,
-.u-cf {
-content: "";
-display: table;
-clear: both; }
-
-
-
-@media (min-width: 400px) {}
-
-@media (min-width: 550px) {}
-
-@media (min-width: 750px) {}
-
-@media (min-width: 1000px) {}
-
-@media (min-width: 1200px) {}
-
-)=====";
+const char* const data_skeleton_css_etag PROGMEM = "\"1f353aaaa125d50f\"";
+const size_t data_skeleton_css_len = 1944;
+const uint8_t data_skeleton_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xcd,0x59,0x5f,0x8f,0xa3,0x36,
+0x10,0x7f,0xcf,0xa7,0x40,0x7b,0x3a,0xa9,0x95,0x00,0x11,0x12,0xd8,0xec,0x46,0xad,
+0x7a,0x6d,0x6f,0xd5,0xa7,0x3e,0xf4,0xb5,0xea,0x83,0x03,0x26,0x58,0xe7,0x00,0x35,
+0xe6,0xb2,0xdb,0xaa,0xdf,0xbd,0x63,0x63,0x07,0xf0,0x1f,0x36,0x7d,0xeb,0xae,0xa2,
+0x84,0x99,0xf1,0x78,0x7e,0x33,0x63,0x33,0x63,0xc7,0x45,0xdb,0x70,0x44,0x1a,0xcc,
+0x82,0xbf,0x37,0x5d,0xdb,0x13,0x4e,0xda,0xe6,0x39,0x60,0x98,0x22,0x4e,0xbe,0xe2,
+0xe3,0xe6,0x4a,0x4a,0x5e,0x3f,0x07,0xdb,0x24,0xf9,0x78,0xdc,0x5c,0xd0,0x6b,0xa4,
+0x08,0x4f,0x79,0xd2,0xbd,0x0a,0x0a,0x3b,0x13,0x18,0x90,0x04,0x68,0xe0,0xed,0x71,
+0xd3,0xa1,0xb2,0x24,0xcd,0x59,0x10,0x52,0x29,0x70,0x6a,0x5f,0xa3,0x9e,0xfc,0x25,
+0x69,0xa7,0x96,0x95,0x98,0x45,0x40,0x3a,0x06,0xff,0x6c,0xe2,0xa2,0xa5,0xc3,0xa5,
+0x09,0xf5,0x8f,0x1e,0x2c,0x58,0xcc,0x56,0xd1,0x16,0xf1,0xe7,0x80,0xe2,0x8a,0xaf,
+0xe9,0xd9,0xfc,0x70,0xc1,0x25,0x41,0xc1,0x37,0x17,0xd2,0x68,0xeb,0xf6,0x09,0x4c,
+0xfe,0x2d,0x28,0x8c,0xe7,0xf8,0x14,0xf3,0x90,0x7d,0x9c,0x1b,0x2a,0x74,0xb8,0xb5,
+0x64,0xd9,0x9a,0x16,0x30,0xd1,0x83,0x62,0x74,0x4a,0x24,0x0c,0x07,0x53,0xe6,0x62,
+0xcf,0x15,0x61,0x3d,0x8f,0x8a,0x9a,0xd0,0x72,0x1a,0x32,0xa7,0x9a,0xc3,0xa5,0x79,
+0x71,0xdb,0xe0,0x69,0xa2,0xe9,0xa1,0xff,0x3b,0xd0,0x80,0xe3,0xfc,0xf6,0xf7,0x38,
+0xce,0xc8,0xaf,0xad,0x25,0xb6,0xdd,0xc5,0xbb,0xdb,0x9f,0x12,0xab,0x19,0xb6,0xf5,
+0xa5,0xe9,0xc7,0x23,0x30,0xab,0x76,0x60,0x13,0x30,0xcd,0xdc,0x25,0xb1,0x39,0x59,
+0x05,0xc9,0xe2,0x10,0x7c,0xb2,0xa6,0xeb,0xc9,0xab,0x6d,0xfc,0x41,0x4e,0xd6,0xe3,
+0xaf,0xb8,0xb1,0x98,0x59,0x6e,0x4d,0x86,0xc9,0xb9,0xe6,0x96,0x60,0x9e,0x59,0x93,
+0x35,0xa4,0x71,0x58,0xf5,0xb8,0x8f,0x13,0x39,0x21,0x77,0x4c,0x77,0x48,0xed,0xe9,
+0xe8,0xdc,0xb0,0x49,0xcf,0xd3,0xd6,0x76,0xe6,0x15,0x53,0x97,0x23,0x64,0x42,0x07,
+0xee,0xc0,0x46,0xbc,0x26,0xac,0x54,0x63,0x56,0x9d,0x0c,0x11,0x1d,0x85,0x7b,0x25,
+0xbd,0x86,0x5d,0x68,0xae,0x11,0xad,0x4c,0x51,0xe1,0x6c,0xb1,0x6a,0xe2,0xb6,0xaa,
+0x7a,0xcc,0xa3,0xd3,0x5b,0xb4,0xcc,0x2e,0x07,0x19,0xdc,0xb3,0xb0,0xfd,0x60,0x67,
+0xdb,0x34,0x6c,0xca,0xbb,0xd0,0x4d,0x36,0xb5,0x6d,0x1f,0x6d,0xe3,0xa7,0x61,0xb3,
+0xf4,0x0c,0x7d,0x0c,0x53,0x63,0x9a,0xcb,0xf8,0x4e,0xc2,0xb3,0x3c,0x0e,0x3d,0x74,
+0x11,0xad,0x85,0x92,0xdd,0x3e,0xf6,0x83,0x9c,0xe5,0x7b,0xe8,0xa1,0x5b,0x0a,0xf7,
+0xbb,0x15,0x9c,0xd3,0xba,0x08,0xdd,0x64,0x13,0x63,0x96,0x1a,0x18,0xe7,0xcb,0x27,
+0xf4,0x31,0x4c,0x2d,0x79,0xb2,0x02,0x72,0xbe,0xce,0x42,0x1f,0xc3,0xd2,0xf8,0xb4,
+0x82,0x72,0xb6,0x20,0x43,0x0f,0xdd,0x72,0xdb,0xe3,0x41,0x2d,0xd7,0x59,0xec,0xdd,
+0x40,0xb9,0x17,0xe6,0x21,0x5f,0x83,0x49,0x7d,0x9e,0xb3,0x56,0xfe,0x42,0xe9,0x53,
+0xb6,0x82,0xd4,0x5c,0xd8,0xe1,0x1a,0xb3,0xff,0x2f,0xa9,0x67,0xed,0x02,0xe1,0x2a,
+0xd7,0x32,0x7b,0x35,0x40,0xc6,0xae,0x11,0xae,0xf0,0x2c,0xc5,0x22,0x23,0xc7,0x77,
+0xe9,0xa6,0xe6,0x17,0x0a,0x6f,0xb2,0x0a,0x5e,0x9b,0xe2,0xad,0x8d,0x61,0xd6,0x34,
+0xce,0x24,0xfb,0xd4,0x96,0x6f,0x4b,0xd6,0x36,0xce,0xf0,0xe5,0x18,0x6c,0x28,0x11,
+0x13,0xc8,0xdc,0x12,0xc4,0xfc,0x38,0x0a,0x5d,0x15,0x05,0xde,0xe9,0x8a,0x52,0xa1,
+0x0b,0xa1,0x6f,0xcf,0xc1,0xc3,0x6f,0x88,0xe2,0x2b,0x7a,0x7b,0x08,0x83,0x87,0x5f,
+0xc4,0xc6,0xcb,0x49,0x81,0x7e,0xc5,0x03,0x5e,0x10,0x02,0x45,0xb9,0x11,0xc2,0xe0,
+0x13,0x23,0x88,0x86,0x41,0x8f,0x9a,0x1e,0x56,0x07,0x23,0xd5,0x71,0x03,0x98,0x5a,
+0xf6,0x1c,0x7c,0x48,0xd3,0x54,0x6e,0x8f,0xf5,0x36,0x0c,0xea,0x14,0x3e,0x3b,0xf8,
+0xec,0xe1,0x93,0xc1,0x27,0x9f,0xde,0xce,0xbc,0xed,0xc4,0x1e,0xae,0x1f,0x4f,0x2d,
+0xe7,0xed,0x05,0x76,0x1e,0x06,0x50,0x96,0x76,0xef,0x12,0xb9,0xd5,0xd7,0x5b,0xf0,
+0xd7,0x0c,0x35,0xbc,0x84,0x84,0x6c,0x60,0xa0,0x4e,0x8f,0x14,0x73,0x0e,0xd5,0x4d,
+0xdf,0xa1,0x42,0x16,0x28,0x51,0xbc,0x15,0x82,0xa0,0x21,0x5d,0x6a,0xd8,0xc5,0xb9,
+0x53,0x43,0x06,0x24,0xb7,0x0e,0x61,0xc6,0xce,0x54,0xe2,0x34,0x63,0x77,0x5c,0x51,
+0xb1,0x5f,0xaa,0x48,0xe3,0xbd,0x53,0x85,0xd3,0x8e,0xe4,0xa0,0xb5,0x64,0x4b,0x2d,
+0xdb,0xf8,0xe0,0xd2,0x92,0x39,0x0c,0x49,0x32,0xad,0x23,0x37,0x75,0x64,0x2e,0x1d,
+0xb9,0xa5,0x23,0xf1,0x15,0x8e,0xb7,0x92,0xcf,0x0c,0x57,0xa6,0xfc,0x64,0x87,0x61,
+0x1f,0xa7,0x5e,0xdf,0xe6,0x1e,0x97,0xed,0x26,0x6d,0x99,0xdb,0x99,0x7e,0x70,0x62,
+0x85,0x75,0x56,0x22,0x0a,0x3c,0x08,0xa8,0x3a,0x8f,0xb7,0x9f,0x3f,0x7d,0xfe,0xf9,
+0x47,0x41,0x46,0xcf,0x75,0xfb,0x55,0x56,0xae,0x9a,0x97,0xbc,0x7c,0x4a,0x7e,0xfa,
+0x3c,0x56,0x01,0xa7,0x01,0x12,0x17,0xd6,0xb9,0xfe,0x26,0x4d,0x37,0xf0,0xdf,0xf9,
+0x5b,0x87,0xbf,0x7b,0xe8,0x87,0xd3,0x85,0xf0,0x87,0x3f,0x96,0x54,0x86,0x61,0x3f,
+0x30,0x89,0xe3,0xf0,0x87,0x3f,0x60,0x96,0x92,0xf4,0x1d,0x45,0xb0,0x3c,0x49,0x23,
+0xe3,0x70,0xa2,0x6d,0xf1,0xe5,0xb8,0xd1,0xe1,0xd8,0x1d,0x44,0x5b,0x30,0xeb,0x13,
+0x32,0xf1,0xac,0x4d,0xcb,0xb2,0xec,0xb8,0xe1,0xf8,0x95,0x47,0x88,0x92,0x33,0x34,
+0x16,0x05,0x6e,0x20,0x72,0xc7,0xc5,0x7e,0xb1,0x15,0x23,0x16,0x6b,0x2c,0x17,0x7b,
+0xc3,0x22,0xea,0xe3,0x34,0x66,0xdc,0xc7,0x1c,0x1e,0x27,0xe0,0x0c,0x96,0x7f,0xd5,
+0x32,0x58,0xb5,0x43,0xd7,0x61,0x56,0xa0,0x1e,0x2b,0x56,0x89,0x8b,0x96,0xa1,0xb1,
+0x15,0x6a,0x60,0xdb,0x83,0x36,0xa8,0x26,0x1c,0x4b,0x3d,0x58,0x90,0xae,0x0c,0x75,
+0xd0,0x93,0xa0,0xe2,0xcb,0x99,0xb5,0x43,0x53,0x46,0xca,0x7e,0xa9,0xb3,0x43,0x0c,
+0x8c,0x16,0x2d,0x8b,0x6c,0x53,0x18,0x2a,0xc9,0xd0,0x43,0x9e,0x8c,0xed,0x90,0xa0,
+0x01,0x86,0xee,0x35,0xe8,0x5b,0x4a,0xca,0xe0,0xc3,0xe9,0x74,0x02,0xfc,0x03,0xeb,
+0x85,0x82,0xae,0x25,0x23,0xde,0x95,0xbe,0x69,0xf4,0xf5,0x18,0x55,0x1d,0x38,0xfd,
+0xe4,0x0a,0x9f,0x8b,0xa7,0x82,0xe8,0x62,0xe9,0x50,0x6a,0x9e,0x9e,0xaf,0x6a,0x8b,
+0xa1,0xbf,0xcd,0xa7,0x9e,0x9c,0xf3,0x39,0x78,0x7a,0x3e,0x07,0xeb,0x36,0x9f,0xe4,
+0xcd,0xd2,0x14,0x5e,0x4f,0x37,0x27,0x6a,0xda,0xe1,0x70,0x38,0x6e,0xda,0x81,0x8b,
+0x58,0xeb,0x1a,0x7a,0x54,0xa0,0xbe,0xa2,0x8e,0x11,0x58,0x19,0x6f,0xda,0x50,0x8b,
+0xec,0xb2,0x78,0x55,0x48,0x99,0xbe,0x2a,0xa3,0x31,0x18,0x42,0x33,0x30,0x2f,0x2f,
+0x2f,0xae,0x84,0x01,0x90,0x3f,0xed,0x5e,0x12,0x0b,0xa7,0x22,0x7b,0xe1,0x2d,0xa3,
+0xef,0x61,0xde,0x01,0x75,0x25,0x37,0xee,0x90,0xf4,0xc0,0x36,0x32,0xc7,0xe4,0x2e,
+0x12,0xc9,0xc3,0xbc,0xc7,0x74,0x7f,0x9a,0xdd,0x21,0xe9,0x33,0xdd,0x4c,0x42,0x5f,
+0xdc,0xd4,0xfe,0x6a,0xc6,0x6d,0xda,0x76,0x0d,0xf0,0x57,0xc4,0xa0,0xc8,0x3d,0x9b,
+0xb0,0x6f,0xe4,0x35,0xc0,0x4e,0x21,0x03,0xaa,0x53,0xc6,0x04,0xa9,0x84,0xee,0x80,
+0x57,0x25,0x4f,0xd8,0xb1,0xfc,0x14,0xd9,0x0b,0xcf,0x9d,0x96,0x06,0xf3,0x0e,0xa8,
+0x77,0xa4,0xe5,0x8a,0xa4,0x07,0xb6,0x27,0x2d,0x35,0xd7,0x99,0x96,0x06,0xf3,0x1e,
+0xd3,0xdf,0x4f,0xcb,0x15,0x49,0x9f,0xe9,0xf7,0xa6,0xe5,0x7f,0x8d,0x5b,0x89,0x9a,
+0xb3,0x1d,0x30,0x4d,0x5d,0x83,0xeb,0x92,0x31,0x70,0xba,0x44,0x4c,0x80,0xa3,0xcc,
+0x1d,0xc8,0x8a,0xc7,0x7d,0xb5,0xaf,0x2c,0x64,0x8a,0xec,0x43,0xe6,0x4e,0xc8,0x25,
+0xef,0x7d,0x94,0x77,0xa4,0xa3,0x5f,0xd0,0x8d,0xd8,0x93,0x8c,0x8a,0xe9,0xcc,0xc5,
+0x25,0xef,0x0e,0xab,0xdf,0xcf,0x44,0xbf,0xa0,0xc7,0xea,0x7b,0xf3,0xf0,0xdd,0x68,
+0x2d,0x26,0xc3,0x17,0x44,0xa8,0x59,0x52,0x36,0xc3,0xe5,0x84,0x99,0x49,0xed,0x31,
+0x62,0x45,0x6d,0x52,0x45,0xd5,0x66,0xd3,0x2c,0x95,0x03,0xb3,0x48,0x1d,0xea,0xfb,
+0x2b,0x18,0x29,0xe8,0x42,0x0b,0xd4,0x6e,0x28,0xdc,0xf4,0xd0,0xf9,0x17,0x5c,0xb4,
+0x01,0xee,0xaa,0x35,0x87,0xf2,0x6d,0x2b,0xce,0xb7,0x03,0xe7,0x22,0xac,0x2a,0x67,
+0xa5,0xf7,0xf3,0x56,0xfc,0xfb,0x0a,0x43,0xa8,0xf7,0x6a,0x54,0xb6,0x57,0x5d,0x72,
+0xfa,0x2b,0xc0,0xff,0xb1,0xeb,0xc0,0x65,0x50,0x94,0x9f,0xbe,0x10,0x28,0xe0,0xa1,
+0xa8,0x46,0x50,0x0f,0x8f,0x15,0xb3,0x40,0x14,0x44,0x97,0xf6,0x2f,0x07,0xdd,0xa2,
+0x00,0xc6,0x99,0x42,0xd1,0x9e,0xe9,0x38,0xe4,0xd9,0x2c,0x0e,0x63,0xef,0x93,0xcf,
+0x29,0xba,0x0f,0x17,0x44,0xb7,0xa7,0x5c,0xc9,0xae,0xfd,0xe5,0x5c,0x5b,0xca,0x6b,
+0x2e,0xde,0xe8,0x3b,0x37,0xc7,0x33,0x95,0xf4,0xa3,0x8b,0x31,0x79,0x53,0x73,0xb5,
+0x0b,0xf4,0xf3,0x98,0x94,0xb7,0x25,0xe8,0x48,0x30,0x5d,0x4c,0x2e,0x0b,0x64,0x8a,
+0x4e,0x98,0x86,0xd0,0x0b,0x9d,0x71,0x53,0xce,0x1b,0x34,0xd5,0x99,0x19,0x47,0x18,
+0x63,0x9b,0x69,0xf7,0x57,0xa0,0xa9,0x22,0x98,0x96,0xb0,0x81,0x88,0xbb,0xa2,0xe9,
+0xfe,0x44,0xe7,0xb3,0x6a,0xa1,0x13,0xd3,0xf1,0x45,0x8d,0x8b,0x2f,0x90,0xba,0x56,
+0x23,0x09,0xf9,0xdf,0xba,0x5a,0xc6,0x9b,0xd1,0xc1,0xf7,0x41,0x2c,0x7f,0x44,0xea,
+0xd4,0xc8,0xd3,0x5b,0x2e,0x8e,0xa1,0x5c,0xf6,0x37,0xd0,0xe6,0x21,0x2a,0xf7,0x9d,
+0x41,0x1c,0x4c,0x51,0xd2,0x43,0x37,0xc9,0xdf,0x28,0xf8,0xa8,0x20,0xac,0xa0,0x18,
+0x34,0xf6,0xa4,0x94,0x53,0xb7,0xa6,0x04,0xb4,0x83,0x50,0x1c,0xd2,0x85,0x48,0x18,
+0x48,0x45,0x3a,0xef,0xf4,0x99,0xbe,0xdd,0x95,0x83,0xd8,0x00,0xde,0x87,0x2f,0x18,
+0x24,0x74,0xab,0x2f,0x39,0x5c,0x5f,0x9f,0x8d,0xbd,0x3d,0x34,0xc3,0xea,0xc7,0x6e,
+0x82,0x30,0xf6,0xbc,0x4f,0xe3,0x6d,0x13,0x25,0x53,0xe3,0xaf,0xe3,0xa5,0x8f,0x65,
+0x60,0x4f,0x2e,0xf1,0x3c,0x32,0xf2,0x5c,0x42,0xbb,0x63,0xba,0xa8,0x8b,0x53,0x97,
+0xf2,0xf7,0x3a,0x5c,0xb1,0xd7,0x6f,0xc5,0xbf,0x73,0x67,0xfb,0xbc,0x15,0xff,0xce,
+0x9d,0x0d,0x2c,0xeb,0x18,0x86,0x48,0x2a,0xf3,0xcc,0xec,0xbb,0x99,0x2b,0x70,0xe8,
+0x43,0x8e,0xa5,0x35,0x30,0x5e,0x02,0xe4,0x35,0x2c,0x8a,0x72,0x0e,0x71,0x9b,0x8a,
+0x8d,0x58,0xee,0x09,0xf3,0x43,0x03,0x7d,0x65,0xa8,0x36,0x4d,0xe5,0x27,0xcb,0x5c,
+0xb1,0xcd,0xd4,0xcb,0x2b,0x39,0x5e,0x1a,0x97,0x71,0x66,0x80,0xc7,0x31,0x14,0x2d,
+0x86,0x4c,0x8f,0xb3,0x11,0x6c,0x4c,0xbd,0xf1,0x68,0x46,0x1f,0xaf,0xa8,0xd7,0xa9,
+0x3f,0x8a,0x72,0x81,0xd8,0xaf,0xa2,0x70,0xbe,0xf6,0xcc,0xa1,0xb7,0x83,0x21,0x70,
+0x14,0x14,0x0d,0xc2,0xaf,0x7f,0x0e,0x2d,0x87,0xdf,0x25,0x15,0x03,0xcf,0x83,0xa0,
+0x73,0x74,0xa2,0xf0,0xd5,0x89,0x5c,0x14,0x19,0x08,0x1c,0x58,0x15,0xb6,0xba,0xf4,
+0xa6,0x6e,0x13,0x0f,0x51,0x35,0x50,0x3a,0xae,0x6c,0xf3,0x7a,0x76,0xe5,0x84,0x62,
+0x88,0xc4,0x4d,0xf1,0x62,0xe8,0xec,0xea,0xf8,0x8e,0xe1,0x9d,0x18,0x2a,0x1d,0x28,
+0x8e,0x8a,0xc7,0x7b,0x60,0xf9,0x38,0xe7,0x8b,0x90,0x4c,0x6c,0x19,0x73,0x79,0x72,
+0xcb,0x8c,0xc3,0xb1,0xdd,0x6c,0x01,0xdc,0x50,0xee,0x54,0xa2,0x99,0x7b,0x97,0x26,
+0xc8,0x91,0xce,0x94,0xd9,0xcc,0xae,0x83,0x9f,0x51,0xc5,0x65,0x15,0xc7,0xe0,0xbd,
+0xad,0x7f,0x0f,0x51,0x51,0xc9,0x12,0xa9,0xe1,0xb8,0x01,0xcb,0x1e,0x1e,0x8e,0x53,
+0xd6,0xcb,0x28,0x1c,0x37,0xb0,0xe3,0x20,0x26,0x80,0xf3,0x7a,0xd4,0xb9,0x76,0x8b,
+0xbd,0x7e,0x54,0xe9,0xe6,0x3e,0xae,0x72,0x21,0x04,0xab,0xec,0xf4,0xc6,0xfe,0x17,
+0x4c,0x49,0x08,0xfe,0x21,0x20,0x00,0x00
+};
 
 // /style.css
 const char* const data_style_css_path PROGMEM = "/style.css";
-const char data_style_css[] PROGMEM = R"=====(
-.logo {
-margin-top: 20px;
-margin-left: 40px;
-position: fixed;
-top: 0;
-left: 0;
-z-index: 999;
-font-weight: bolder;
-}
-#header {
-height: 40px;
-width: 100%;
-position: fixed;
-top: 0;
-right: 0;
-padding-top: 5px;
-background-color: #FbFbFb;
-color:#888;
-z-index: 998;
-text-align: right;
-}
-#header h5 {
-margin-right: 20px;
-margin-top: 5px;
-}
-#footer {
-height: 30px;
-width: 100%;
-position: fixed;
-bottom: 10px;
-left: 10px;
-font-size: 11px;
-color:#888;
-}
-.version {
-text-align: center;
-font-size: 11px;
-color:#888;
-}
-#sidebar {
-height: 100%;
-width: 120px;
-position: fixed;
-top: 0;
-left: 0;
-padding: 60px 5px 0 5px;
-border: 1px solid #ececec;
-border-width: 0 1px 0 0;
-z-index: 998;
-background-color: #FbFbFb;
-}
-#content {
-padding-left: 155px;
-padding-top: 70px;
-padding-right: 30px;
-}
-input[type="file"] {
-display: none;
-}
-.custom-file-upload {
-border: 1px solid #ccc;
-display: inline-block;
-padding: 6px 12px;
-cursor: pointer;
-border-radius: 4px;
-height: 25px;
-}
-.extrafunc {
-position: absolute;
-top: 30px;
-right: -10px;
-}
-.grey {
-color: #888
-}
-.text-primary {
-color: #1EAEDB;
-}
-.text-success {
-color: #60a75e;
-}
-.text-warning {
-color: #f09e33;
-}
-.text-danger {
-color: #c74f4f;
-}
-.hrborder {
-border: 1px solid #ececec;
-border-width: 0 0 1px 0;
-max-width: 80%;
-}
-input:disabled {
-background-color: #dddddd;
-}
-.w100 {
-width: 100%;
-}
-.clear {
-clear: both;
-}
-.hand {
-cursor: pointer;
-}
-.center{
-margin-left: 50%;
-}
-.hidden {
-display: none;
-}
-.inputcomment {
-color: #6e6e6e;;
-font-size: 12px;
-margin-top: -8px;
-padding-left: 5px;
-}
-/* Absolute Center Spinner */
-.loading {
-position: fixed;
-z-index: 999;
-height: 2em;
-width: 2em;
-overflow: visible;
-margin: auto;
-top: 0;
-left: 0;
-bottom: 0;
-right: 0;
-}
-/* Transparent Overlay */
-.loading:before {
-content: '';
-display: block;
-position: fixed;
-top: 0;
-left: 0;
-width: 100%;
-height: 100%;
-background-color: rgba(202,202,202,0.9);
-}
-.loading:not(:required):after {
-content: '';
-display: block;
-font-size: 10px;
-width: 1em;
-height: 1em;
-margin-top: -0.5em;
--webkit-animation: spinner 1500ms infinite linear;
--moz-animation: spinner 1500ms infinite linear;
--ms-animation: spinner 1500ms infinite linear;
--o-animation: spinner 1500ms infinite linear;
-animation: spinner 1500ms infinite linear;
-border-radius: 0.5em;
--webkit-box-shadow: rgba(0, 0, 0, 0.75) 1.5em 0 0 0, rgba(0, 0, 0, 0.75) 1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) 0 1.5em 0 0, rgba(0, 0, 0, 0.75) -1.1em 1.1em 0 0, rgba(0, 0, 0, 0.5) -1.5em 0 0 0, rgba(0, 0, 0, 0.5) -1.1em -1.1em 0 0, rgba(0, 0, 0, 0.75) 0 -1.5em 0 0, rgba(0, 0, 0, 0.75) 1.1em -1.1em 0 0;
-box-shadow: rgba(0, 0, 0, 0.75) 1.5em 0 0 0, rgba(0, 0, 0, 0.75) 1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) 0 1.5em 0 0, rgba(0, 0, 0, 0.75) -1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) -1.5em 0 0 0, rgba(0, 0, 0, 0.75) -1.1em -1.1em 0 0, rgba(0, 0, 0, 0.75) 0 -1.5em 0 0, rgba(0, 0, 0, 0.75) 1.1em -1.1em 0 0;
-}
-/* Animation */
-@-webkit-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@-moz-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@-o-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-/* The Modal (background) */
-.modal {
-display: none; /* Hidden by default */
-position: fixed; /* Stay in place */
-z-index: 1; /* Sit on top */
-padding-top: 100px; /* Location of the box */
-left: 0;
-top: 0;
-width: 100%; /* Full width */
-height: 100%; /* Full height */
-overflow: auto; /* Enable scroll if needed */
-background-color: rgb(202,202,202); /* Fallback color */
-background-color: rgba(202,202,202,0.9); /* Black w/ opacity */
-}
-/* Modal Content */
-.modal-content {
-background-color: #fefefe;
-margin-left: 150px;
-margin-right: 30px;
-padding: 20px;
-border: 1px solid #888;
-}
-/* The Close Button */
-.close {
-color: #aaaaaa;
-float: right;
-font-size: 28px;
-font-weight: bold;
-}
-.close:hover,
-.close:focus {
-color: #000;
-text-decoration: none;
-cursor: pointer;
-}
-/* Start loading trick */
-#loadingStart {display: none !important;}
-#main { display: block !important; }
-)=====";
+const char* const data_style_css_etag PROGMEM = "\"376d374157be6075\"";
+const size_t data_style_css_len = 1334;
+const uint8_t data_style_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xed,0x58,0x51,0x6f,0xdb,0x36,
+0x10,0x7e,0xd7,0xaf,0xe0,0x6a,0x14,0x8d,0x8b,0xc8,0x91,0x9d,0x38,0x76,0x64,0x0c,
+0x68,0x93,0xa5,0xd8,0xc3,0x8a,0x3e,0x74,0x6f,0xc3,0x1e,0x28,0x89,0xb2,0x89,0xc8,
+0xa4,0x46,0x52,0xb5,0x93,0xc0,0xff,0x7d,0x77,0x24,0x25,0x4b,0x8e,0x63,0x37,0x40,
+0xf6,0x30,0x20,0x51,0xe2,0xc8,0xbc,0x8f,0xe4,0xdd,0x77,0xc7,0xd3,0x9d,0x06,0x85,
+0x9c,0x4b,0xf2,0x18,0x2c,0xa9,0x9a,0x73,0x11,0x1a,0x59,0xc6,0x64,0x14,0x95,0xeb,
+0x59,0x3d,0x52,0xb0,0xdc,0xc4,0xe4,0xc2,0x0e,0x95,0x52,0x73,0xc3,0xa5,0x88,0x49,
+0xce,0xd7,0x2c,0x9b,0x05,0x16,0x1e,0xcd,0x02,0x07,0x82,0x9b,0x87,0x90,0x8b,0x8c,
+0xad,0x63,0x72,0x75,0x75,0x35,0x0b,0x72,0x29,0x4c,0xb8,0x62,0x7c,0xbe,0x00,0x69,
+0x22,0x8b,0x8c,0xa9,0x59,0xb0,0x09,0x7a,0x0b,0x46,0xe1,0x16,0x76,0x5d,0x78,0x99,
+0x5b,0x7e,0xc5,0x33,0xb3,0x88,0xc9,0x30,0x8a,0xde,0x1f,0xd8,0x4b,0xb9,0x29,0x70,
+0x57,0xd2,0x2c,0xe3,0x62,0xee,0x94,0x1e,0xe3,0x0a,0x09,0x4d,0xef,0xe6,0x4a,0x56,
+0x22,0x0b,0x53,0x59,0x48,0x15,0x93,0xde,0x97,0x04,0xaf,0x59,0xe0,0xbe,0xf7,0xa6,
+0xd3,0x69,0x47,0x4b,0xf8,0x66,0xd8,0xda,0x84,0xb4,0xe0,0x73,0xd8,0xcb,0x2e,0xde,
+0xd6,0x71,0x31,0xde,0x92,0xe3,0x77,0xee,0xd0,0xb3,0xdd,0x1b,0xe6,0xe4,0x52,0x9a,
+0x8e,0x5d,0xe7,0x3f,0x61,0x57,0x22,0x8d,0x91,0x4b,0x14,0x23,0xd6,0x31,0xe9,0xee,
+0x2d,0x7d,0x9a,0x3f,0x30,0x18,0x18,0xe2,0x40,0xdb,0x86,0x4d,0x30,0xf8,0xc1,0x94,
+0x86,0x95,0x60,0xbf,0xb6,0x09,0x29,0x13,0x06,0x79,0x3e,0x32,0xbb,0xa7,0x79,0xc6,
+0x12,0xda,0xd6,0xd6,0x29,0x58,0x6b,0x3b,0xfa,0x49,0x97,0x7b,0x2f,0xc4,0xe4,0x12,
+0x26,0x20,0x15,0x24,0xf2,0xce,0x90,0x0a,0x18,0x84,0x95,0x60,0x48,0xcb,0x82,0x67,
+0xa4,0xc7,0x52,0xbc,0x6a,0x51,0xe8,0xb7,0x8a,0x2c,0x24,0xda,0x89,0x9f,0xe9,0x41,
+0x77,0x82,0x01,0x29,0x18,0x08,0xb6,0x82,0x01,0x75,0x20,0x78,0xf2,0xc6,0x76,0xfb,
+0x4e,0x74,0x4c,0xa2,0xf6,0x90,0x6a,0x7b,0x67,0x13,0x70,0x51,0x56,0xe6,0x2f,0x73,
+0x5f,0xb2,0x5f,0xdf,0xe5,0xbc,0x60,0xef,0xfe,0x86,0x35,0x33,0xae,0xcb,0x82,0xde,
+0xc7,0x44,0x48,0xc1,0x2c,0xdd,0x69,0xa5,0xc1,0x51,0x21,0x22,0xc2,0xaa,0x2c,0x24,
+0xcd,0x00,0xb6,0xc7,0xc8,0x34,0x05,0x0b,0x9b,0xe9,0x5c,0x14,0x5c,0xb0,0x30,0x29,
+0x64,0x7a,0xd7,0x26,0x0b,0xf0,0xc3,0x91,0x75,0x4b,0xa5,0x34,0x9a,0x56,0x4a,0xee,
+0x1c,0xe7,0xc9,0x51,0x34,0xe3,0x95,0x86,0xb3,0x81,0xa0,0xda,0x45,0x23,0x1f,0x6a,
+0x03,0x70,0xb8,0xa2,0x79,0x25,0x52,0x34,0xbf,0xf1,0x11,0x4d,0x40,0x87,0xca,0x30,
+0xef,0x26,0x67,0xa0,0xb7,0x36,0x1c,0x7a,0x73,0x07,0x73,0xc5,0xee,0x61,0x5a,0x4d,
+0x29,0x04,0x04,0x8e,0xda,0x18,0x2a,0x15,0x87,0xc0,0x6e,0x4b,0x87,0xb7,0x9f,0x6f,
+0x7f,0xbb,0x9e,0x35,0x08,0x5d,0xa5,0x29,0xd3,0xba,0x85,0xb8,0x8c,0xe8,0x64,0xcc,
+0xb6,0x88,0x15,0x55,0x02,0x6c,0x6c,0x21,0xf2,0xe8,0x8a,0x9d,0x9f,0x6f,0x11,0x19,
+0x15,0x73,0x7b,0x4e,0x6a,0x40,0x3a,0xb9,0xc8,0x2f,0x72,0x0b,0x58,0x28,0x67,0xff,
+0x7e,0x6e,0x9f,0x0b,0x20,0x1f,0x42,0x78,0x2c,0xd7,0xf5,0xe8,0x14,0xa3,0xd9,0x7b,
+0x37,0x06,0x7f,0xd0,0xa4,0x60,0xd6,0x65,0x4f,0xa3,0x2a,0xb3,0x3f,0x76,0xff,0x15,
+0x9c,0x02,0x00,0x75,0xce,0x2c,0x3a,0xbf,0x60,0xf6,0xac,0xd8,0xff,0x98,0xcc,0xcc,
+0xc2,0xa9,0x4b,0x05,0xae,0xf9,0xc4,0x89,0x38,0xc5,0x1e,0xc4,0xc7,0x6e,0x22,0x1d,
+0xfb,0xf5,0x16,0x3c,0xcb,0x98,0xd8,0x1b,0x67,0x56,0xe1,0x54,0x2e,0x97,0x2e,0xb8,
+0x1b,0x9a,0x19,0x5e,0xb3,0xee,0xc1,0x1e,0xed,0xa6,0xa2,0x70,0xda,0x0e,0x74,0xbf,
+0xa7,0xf3,0xfb,0xd9,0x47,0xf2,0xd9,0xc7,0x07,0xb9,0xb1,0xba,0x91,0xef,0x25,0x17,
+0x02,0xfe,0x7f,0x3c,0x0b,0x06,0x18,0xd0,0xce,0x6d,0x4f,0xce,0x7c,0x37,0xab,0x37,
+0xb1,0xc8,0x96,0x4d,0xb6,0xb0,0xf7,0x12,0x12,0x52,0x5e,0xc8,0x55,0x4c,0x7e,0x70,
+0xcd,0x81,0xed,0x5a,0x35,0x08,0xcc,0xca,0xc8,0x3d,0xb9,0xa3,0xce,0x7d,0x9d,0xb4,
+0x6e,0x35,0xfd,0x53,0x51,0xa1,0x4b,0xaa,0x90,0x83,0x6f,0xb0,0x2e,0x50,0xd4,0xd6,
+0x32,0x4e,0x58,0x2e,0x15,0xb3,0xf4,0xd8,0x2c,0x10,0x93,0x0f,0x1f,0x5a,0xa7,0xae,
+0x3e,0x6e,0x47,0xb3,0x57,0xc7,0xcf,0xdd,0x44,0xf8,0x34,0x4e,0xd4,0x3c,0xa1,0x27,
+0xa3,0x68,0x74,0x5a,0xff,0x45,0x83,0xab,0xbe,0xf5,0x59,0xad,0x96,0x90,0xe6,0x24,
+0x56,0xec,0x9f,0x8a,0x2b,0x96,0xf5,0x63,0x9a,0x1b,0x1f,0xe7,0x07,0x94,0x6c,0xfb,
+0xb3,0xf3,0xbc,0x40,0x4e,0x1b,0x95,0xf0,0x4b,0xc7,0xd1,0xd1,0x60,0x8c,0x63,0xf0,
+0x7c,0x4d,0xee,0x38,0x64,0x7f,0x01,0x27,0xd7,0xd9,0xaa,0xbd,0x57,0x87,0xe3,0x28,
+0x5a,0x6a,0xc8,0x40,0x39,0x17,0x1c,0x9c,0x8e,0x89,0x88,0x42,0x6c,0x86,0x4b,0xf9,
+0xf0,0x32,0xbc,0x7e,0x11,0x5c,0xbe,0x04,0xfd,0x02,0xe8,0x4e,0x62,0xdc,0x21,0x20,
+0x91,0xeb,0x50,0x2f,0x68,0x86,0xf1,0x67,0x1d,0x15,0x9d,0x12,0xff,0x3b,0x98,0x8c,
+0xfb,0x64,0x88,0x70,0x9b,0x2a,0x60,0x68,0x3f,0x00,0x48,0xf6,0x9f,0xcf,0x82,0xa2,
+0xed,0x3a,0xfb,0x01,0xe1,0xd1,0x65,0x1c,0xe8,0x80,0x32,0xdb,0x55,0xc2,0xa3,0xda,
+0x84,0x47,0xd4,0xd9,0x5d,0x07,0x59,0xfc,0x9f,0xf0,0x34,0x39,0x4a,0xd4,0xe4,0xbf,
+0x65,0xca,0xa5,0xcc,0x3a,0x3e,0x31,0xfd,0x7c,0xaa,0x83,0xed,0x8e,0xdd,0xe7,0x8a,
+0x2e,0x99,0x6e,0x82,0xf6,0x31,0x88,0xde,0xc3,0x47,0x0d,0x30,0x98,0xbf,0x20,0x45,
+0x41,0x72,0x53,0xd2,0x50,0xc3,0x4e,0xa2,0x8c,0xcd,0xfb,0xfe,0xf0,0x1d,0x90,0xea,
+0x03,0x42,0xf9,0xbc,0xec,0x59,0xc1,0x26,0xc0,0x6c,0x76,0x50,0xb3,0xf3,0xcb,0xc3,
+0xba,0xb5,0xe4,0xfa,0xa0,0x58,0x1e,0x92,0x1e,0x10,0x6d,0xe0,0xfa,0x64,0x37,0x7f,
+0xe3,0xf5,0xf5,0x79,0x95,0x6f,0xac,0xbe,0x3e,0xab,0x6f,0x94,0xbe,0x36,0xa5,0x58,
+0xf4,0x2d,0x18,0xf9,0x2a,0x33,0x5a,0x90,0x93,0x6d,0xf1,0xd5,0xb7,0x75,0xdf,0xd2,
+0x0e,0xef,0x96,0xcb,0x04,0x26,0xfd,0xee,0x2a,0xe9,0xe4,0x9e,0x64,0x2c,0xa7,0x55,
+0x61,0x10,0xbf,0x5b,0xf8,0x21,0xf0,0xbb,0x81,0x1a,0x92,0x0b,0x02,0xf3,0x53,0x86,
+0xa0,0xa6,0xac,0x1d,0x3a,0x39,0x37,0x04,0xd2,0x3c,0x54,0x57,0x76,0x85,0x76,0xfb,
+0x08,0x0c,0x42,0x61,0x86,0xa0,0x3f,0x64,0xea,0x9e,0x06,0x32,0x27,0x06,0xd4,0x85,
+0xa7,0x29,0xa2,0x9b,0x7a,0xb2,0x2e,0x30,0xdb,0x75,0x25,0xce,0xfb,0x52,0x15,0x05,
+0xb1,0x83,0x08,0xef,0x14,0x9a,0x8d,0xd8,0x8d,0xa2,0x7c,0x5b,0x49,0xdb,0xc2,0x19,
+0x11,0xb7,0x02,0xfb,0x17,0xa2,0x53,0x25,0x01,0xca,0x73,0x22,0x18,0xcb,0xa0,0x9f,
+0x01,0xf4,0xde,0x42,0xb5,0x5d,0xa7,0xf6,0xdd,0x1e,0xb4,0x28,0x10,0x4a,0x2c,0xe8,
+0xd9,0x89,0x7b,0x2a,0x5c,0x9c,0x7d,0x5d,0xe0,0xd4,0xd5,0x19,0x91,0x25,0x4d,0xb9,
+0xb1,0xd5,0xb8,0x75,0x9a,0x73,0xd8,0x8d,0x6f,0xc6,0x1b,0x5f,0x85,0xdb,0xf6,0x7c,
+0x4f,0xc3,0x95,0x33,0xbc,0x76,0x5e,0x32,0x41,0xdd,0xd7,0x6a,0x67,0x3a,0x4d,0x7a,
+0xd3,0x37,0xbb,0xb7,0x12,0x7b,0x3a,0x43,0xff,0x5a,0xc3,0x47,0xd1,0x4d,0x21,0x35,
+0x23,0xd7,0x15,0xb4,0x17,0xf6,0xc1,0x0d,0xfd,0x1b,0x0e,0x6c,0xbb,0x29,0x6a,0x7f,
+0xa0,0xf8,0x86,0xca,0xdd,0x34,0xef,0x7d,0x5a,0xa5,0xf8,0x68,0xda,0xbc,0x82,0x69,
+0xbf,0xc1,0xf2,0xcd,0x20,0x2c,0x16,0x2f,0xd0,0x4b,0xa7,0xf5,0xb7,0x5c,0xa6,0x55,
+0xbb,0x2b,0x8e,0xa2,0xc8,0xbf,0x5a,0xca,0x58,0x2a,0x95,0x2f,0x71,0x5d,0x93,0xb7,
+0xa7,0x5b,0x74,0xf1,0xa9,0x0c,0xa9,0xdb,0x30,0xa3,0x38,0xf0,0x0d,0xaa,0xf7,0xfc,
+0x88,0x13,0x3f,0x76,0x0e,0x00,0xf9,0x85,0x2f,0x4b,0xa9,0x0c,0x15,0x66,0xb6,0x09,
+0x7a,0x4b,0x0a,0xe1,0xfd,0x48,0xba,0x0d,0x46,0x1b,0x43,0x36,0xff,0x02,0xe9,0x67,
+0x66,0x83,0xf0,0x13,0x00,0x00
+};
 
-// /update.
-const char* const data_update_html_path PROGMEM = "/update.";
-const char data_update_html[] PROGMEM = R"=====(
-<!DOCTYPE HTML><html>
-<head>
-<meta http-equiv="Content-Type" content="text/html; charset=utf-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1" />
-<meta http-equiv="Cache-Control" content="no-cache, no-store, must-revalidate" />
-<meta http-equiv="Pragma" content="no-cache" />
-<meta http-equiv="Expires" content="0" />
-<title>Dice - Administration</title>
-</head>
-<body>
-<div id="loadingStart">Loading...</div>
-<div id="main" style="display: none;">
-<div class="loading" id="loader" style="display: none;">
-<div style="margin-left: -25px">Loading...</div>
-<div>&#8230;</div>
-</div>
-<div class="logo">
-Dice
-</div>
-<div id="header">
-<div class="row">
-<h5>Dice</h5>
-</div>
-</div>
-<div id="sidebar">
-<a class="button w100" href="/">home</a>
-<a class="button w100" href="/update">update</a>
-<!--<a class="button w100 button-danger" id="reset" href="#">reset</a>-->
-<div class="version" id="version">v0.01 - 9</div>
-<div id="footer">
-<div><a href="https://github.com/redakker/blecker" target="_blank">blecker</a></div>
-</div>
-</div>
-<div id="content">
-<div class="contaier">
-<!-- The Modal -->
-<div id="myModal" class="modal" style="display: none;">
-<!-- Modal content -->
-<div class="modal-content">
-<span class="close">&times;</span>
-<p>Some text in the Modal..</p>
-</div>
-</div>
-<p id="support-notice">Please browse your update file from your device.<br />
-Check for newer update files on the project repository <a href="https://github.com/redakker/" target="blank">https://github.com/redakker/</a> website.</p>
-<p class="text-danger" id="error" style="display: none;">The chosen file is probably not a valid update file.</p>
-<form action="/upgrade" method="post" enctype="multipart/form-data" id="form-id">
-<label for="file-upload" id="custom-file-upload" class="custom-file-upload" onclick="getFile()">
-<input id="file-id" type="file" name="our-file" onchange="getFileName(this)"/>
-<span id="fileinput" class="">Choose a file!</span>
-</label>
-<input type="button" value="Upload" id="upload-button-id" disabled="disabled" />
-<p id="upload-status"></p>
-<p id="progress"></p>
-<pre id="result"></pre>
-</form>
-</div>
-</div>
-<script type="text/javascript" src="/functions.js"></script>
-</div>
-</body>
-</html>
+// /functions.js
+const char* const data_functions_js_path PROGMEM = "/functions.js";
+const char* const data_functions_js_etag PROGMEM = "\"fdf536132249d67e\"";
+const size_t data_functions_js_len = 3186;
+const uint8_t data_functions_js[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xcd,0x5a,0x7b,0x6f,0xdb,0x46,
+0x12,0xff,0x5f,0x9f,0x62,0x43,0xe0,0x4a,0xea,0x22,0xd3,0xb2,0x1d,0xc7,0x4d,0x14,
+0x27,0x70,0xd2,0xa4,0x71,0xd1,0x3c,0x10,0xbb,0x68,0x00,0xc7,0x28,0x56,0xe4,0xca,
+0x62,0x4c,0x91,0x3c,0x72,0x25,0xd9,0x75,0xfd,0xdd,0xef,0x37,0xb3,0xbb,0x24,0xf5,
+0x72,0x9c,0xeb,0x1d,0x70,0x0d,0xd0,0x88,0xbb,0xb3,0xb3,0xf3,0x7e,0x6d,0xb6,0xb7,
+0xc5,0xbb,0x69,0xa5,0xc5,0x50,0x09,0x29,0x46,0xa9,0xd4,0xe2,0x6b,0x95,0x67,0x22,
+0x1f,0x7e,0x55,0x91,0xee,0xa4,0x0a,0x3b,0xb9,0x2c,0xe3,0x9f,0xa4,0x96,0xe2,0x50,
+0xdc,0xdc,0x0e,0x78,0x4d,0x7e,0x95,0x57,0xad,0x4f,0x9d,0x4c,0x54,0x39,0x68,0xa0,
+0x33,0x39,0x51,0xe6,0xb3,0x54,0x95,0xd2,0x51,0x9e,0x8d,0x92,0x0b,0xc0,0x8f,0x64,
+0x5a,0xd9,0x0d,0x19,0xcf,0x64,0x16,0xa9,0xf8,0xbd,0xd2,0xf3,0xbc,0xbc,0x5c,0xdc,
+0x2c,0xd5,0x30,0xcf,0xf5,0xab,0xb1,0x8a,0x2e,0xcd,0xc2,0xcb,0x0f,0x47,0x9f,0x7e,
+0xfa,0xe3,0xfd,0xd1,0xbb,0xd7,0x00,0xf4,0x54,0x55,0xec,0xed,0xc6,0x6a,0xe6,0x0d,
+0x3a,0xdb,0xdb,0xe2,0xe8,0x97,0xa3,0xcf,0xa2,0x52,0xe5,0x2c,0x89,0x54,0x87,0x08,
+0x0b,0x89,0xb4,0xd1,0x34,0x8b,0x74,0x02,0x4e,0x82,0xae,0xb8,0xe9,0x24,0x23,0x11,
+0xe8,0xeb,0x42,0xe5,0x23,0xf1,0xf9,0xdd,0xaf,0x6f,0xb5,0x2e,0x3e,0xa9,0x7f,0x4d,
+0x15,0xf8,0x7e,0x70,0x78,0x28,0xfc,0x69,0x16,0xab,0x51,0x92,0xa9,0xd8,0x27,0xe0,
+0x52,0xe9,0x69,0x99,0x89,0x4c,0xcd,0x97,0x80,0x83,0xee,0xa0,0x73,0xdb,0x99,0xc9,
+0x52,0xcc,0x54,0x59,0x01,0x79,0x85,0x8b,0xce,0x3a,0xde,0xbb,0x13,0xc0,0xed,0x86,
+0x9f,0x27,0x29,0x01,0x87,0x8f,0xc3,0xbe,0xd7,0x5b,0x59,0xdd,0x5f,0xbb,0xfa,0x68,
+0xed,0xea,0xde,0xda,0xd5,0x5d,0xbb,0x9a,0x44,0x65,0x5e,0xe5,0x23,0xed,0x36,0xbc,
+0xce,0xf9,0x80,0xa9,0xba,0x1a,0x43,0x09,0xa3,0xbc,0x14,0x01,0x7d,0x25,0x20,0xae,
+0x3f,0xc0,0x5f,0xcf,0x6a,0x72,0xc3,0x54,0x65,0x17,0x7a,0x8c,0xc5,0x87,0x0f,0x89,
+0x53,0x5d,0x5e,0xe3,0xff,0x38,0x06,0x50,0x62,0xf7,0x08,0x22,0x9b,0xa9,0xcf,0x1f,
+0x58,0xf9,0x81,0x3b,0x75,0x96,0x9c,0x83,0xf1,0x61,0xa9,0x24,0xb4,0x71,0x2b,0x22,
+0xa9,0xa3,0xb1,0x08,0x14,0x21,0xb8,0xc5,0x1f,0x2b,0x2e,0xbe,0x1c,0xf6,0xc0,0x1a,
+0xa8,0x54,0x16,0x2f,0x28,0x61,0x5a,0xa6,0x3d,0x9c,0x4c,0xd3,0xa1,0x8c,0x2e,0x7b,
+0x62,0xa2,0xf4,0x38,0x8f,0x7b,0x22,0x86,0x59,0xf5,0x84,0xac,0xae,0xb3,0xc8,0xa9,
+0x89,0x3f,0xc4,0x21,0xd4,0x52,0x6b,0x85,0xb6,0xec,0xb2,0xd0,0xe5,0x54,0x39,0x2d,
+0x90,0x9e,0x8d,0xc2,0x49,0x33,0x57,0x61,0x5e,0xa8,0x2c,0x70,0xa8,0xf9,0x46,0x83,
+0x99,0xf7,0x32,0xd0,0x1f,0x5f,0x57,0x5a,0x6a,0x15,0x8d,0x65,0x76,0xa1,0xd6,0x1a,
+0xc9,0x55,0xc8,0x60,0x27,0x04,0x06,0x22,0xc4,0x23,0xda,0x70,0x74,0xf3,0x6e,0x55,
+0x40,0x24,0xea,0x54,0x5d,0xe9,0x9e,0x00,0xa3,0x00,0x9c,0x56,0x5d,0x12,0xc4,0x80,
+0x11,0x98,0xeb,0xe9,0xa8,0xff,0xf1,0xc3,0xc9,0x29,0x1b,0x14,0xc9,0x43,0x5b,0x1b,
+0x7a,0x0b,0xf4,0xaa,0x0c,0xfc,0x57,0x79,0xa6,0x55,0xa6,0xb7,0xc8,0x2a,0xfd,0x9e,
+0xf0,0x65,0x51,0xa4,0x09,0x44,0x0b,0x6a,0xb6,0xaf,0xb6,0xe6,0xf3,0xf9,0x16,0x14,
+0x39,0xd9,0x02,0x17,0x2a,0x8b,0xf2,0x98,0x4c,0x93,0xd8,0x36,0xa2,0x0d,0x48,0x6e,
+0xdd,0x5a,0xda,0x17,0xf0,0x90,0x15,0x61,0x1b,0xd1,0x36,0x22,0xaf,0x85,0x4c,0x92,
+0x03,0x29,0x50,0x3d,0x8c,0xf7,0xbc,0x65,0x30,0x97,0xea,0x5a,0x24,0x19,0x1f,0x24,
+0x38,0x86,0x09,0x8b,0x69,0x35,0x0e,0x68,0xe7,0xa1,0xf0,0x0f,0x7d,0xfc,0x9f,0xb6,
+0xcf,0xb0,0x70,0xce,0xf4,0xd4,0xda,0xa6,0x4b,0xb1,0x1b,0x98,0x53,0xc6,0xce,0xc4,
+0x0b,0xe1,0xbf,0xa0,0x33,0x66,0xf1,0x6b,0x9e,0x64,0x81,0xff,0x03,0x44,0xf2,0x54,
+0xf8,0x7e,0xb7,0x4d,0x9c,0xff,0xf3,0xeb,0x53,0x48,0x21,0x9b,0xa6,0xb5,0xd2,0x6a,
+0xee,0x8a,0xbc,0xfa,0xff,0x60,0x6f,0x81,0x60,0x56,0x6e,0x6f,0x99,0xb3,0x36,0xf1,
+0x14,0x9a,0x28,0x4c,0x4e,0x8b,0x34,0x97,0x31,0x7d,0xbe,0x71,0x2c,0xe8,0x31,0xe2,
+0xec,0x3c,0x49,0x53,0x01,0x84,0xf9,0x5c,0x4c,0x2b,0xa1,0x73,0x71,0x99,0xe1,0x27,
+0x6c,0xa8,0x75,0xaa,0x12,0xb2,0x54,0xa2,0x9a,0x16,0x45,0x5e,0x6a,0x15,0x77,0x6a,
+0x21,0xd8,0x25,0x02,0xfd,0x8d,0x21,0x7f,0x4f,0xf4,0xf8,0x63,0x99,0x5f,0xc0,0x40,
+0xab,0xa0,0x15,0xc5,0x2c,0xe0,0x9b,0x24,0x55,0x47,0x1f,0x8f,0xb1,0xf3,0xc3,0x0f,
+0xab,0x87,0xdd,0xc1,0xd7,0x33,0x98,0x64,0xb5,0x00,0xf4,0x06,0x56,0x48,0xc1,0x9f,
+0x3c,0x0c,0x2c,0x1c,0x83,0xd2,0xb1,0x12,0x84,0x4e,0x00,0x5f,0x43,0xda,0x8b,0x15,
+0xda,0x9a,0x2b,0x8d,0x52,0x46,0x14,0x90,0xe2,0x3c,0x9a,0x4e,0x70,0x49,0x18,0xc1,
+0xcf,0xb4,0x7a,0x9d,0x2a,0xfa,0x0a,0xfc,0xe3,0xf7,0x1f,0x7f,0x3b,0x25,0x13,0x1f,
+0x25,0x21,0xb9,0x04,0x40,0xfd,0x11,0x10,0xf8,0x03,0xc7,0x08,0x7f,0x56,0x3e,0xa9,
+0x70,0x94,0x0c,0x9c,0x80,0x21,0x9d,0xc2,0x12,0x2f,0x14,0x53,0x7f,0x17,0x49,0x77,
+0x70,0x7c,0xe3,0x22,0xa8,0x0d,0x85,0xab,0x91,0xdf,0xd2,0xf1,0xe0,0x01,0xa2,0x04,
+0xc0,0x20,0xa2,0xc0,0x37,0x5a,0x62,0xa2,0xb0,0xd6,0x35,0x8b,0x79,0xe6,0x48,0x72,
+0x1b,0xa1,0x81,0xeb,0x76,0x1d,0xdd,0x10,0xa3,0x13,0xec,0x9d,0x22,0xac,0x85,0xdf,
+0x28,0x14,0xf7,0xcf,0x93,0x2c,0xce,0xe7,0xa1,0xdb,0x1d,0x70,0x18,0xae,0xcf,0x26,
+0x59,0xa2,0xdf,0xc0,0x91,0x68,0xbb,0x61,0xb8,0x51,0x03,0x96,0xdb,0x8a,0x40,0xf0,
+0xb0,0x5a,0x78,0x79,0x7d,0x1c,0x07,0x3e,0x87,0x9d,0x84,0xc3,0x0d,0xfd,0x44,0xe0,
+0xac,0xa6,0xc3,0x49,0xd2,0x76,0x41,0xc6,0x45,0xf6,0xec,0x58,0x28,0x55,0xa4,0x90,
+0x38,0x8c,0x6d,0xcc,0xc7,0x39,0x8c,0x83,0xce,0xd6,0xf7,0xd9,0xea,0x81,0xe4,0x5a,
+0xb3,0x44,0xeb,0xc6,0xa6,0x7e,0x87,0x85,0x53,0xbe,0xa0,0xc3,0xe4,0x7e,0xc0,0xa0,
+0xa0,0x57,0xfa,0x64,0x62,0xe7,0x32,0x23,0xdb,0x27,0x64,0xd2,0xb0,0x78,0xc8,0x1b,
+0x44,0xfa,0x91,0xd6,0x65,0x32,0x9c,0x6a,0x15,0xf8,0x66,0xcf,0x37,0x38,0x5f,0x21,
+0x64,0x8a,0x28,0x9f,0x4c,0xc8,0xdb,0x72,0x54,0x25,0x88,0x46,0x40,0x90,0x00,0x55,
+0xd5,0xa1,0xdb,0x3e,0xbf,0x75,0xaa,0x75,0x04,0xf6,0x2c,0x76,0x83,0xe0,0x68,0x96,
+0x27,0xb1,0xc8,0xb0,0x27,0x53,0x43,0x06,0x8b,0xa1,0xa2,0x8c,0xe8,0x54,0x61,0x2b,
+0x96,0x55,0xe9,0xc3,0x52,0x3f,0x64,0xe9,0xf5,0x1a,0xe9,0x1b,0x43,0x78,0xa9,0xb3,
+0xbb,0x54,0x60,0x80,0xb6,0xc0,0x96,0xce,0x33,0xab,0x8b,0xfa,0x20,0x14,0x12,0x21,
+0x53,0x5c,0x2e,0x84,0x44,0x35,0xd3,0x6d,0xfd,0xae,0x93,0xb7,0x61,0xeb,0x24,0x41,
+0xd1,0x05,0xd1,0x26,0x95,0x48,0x8c,0xba,0xc8,0xad,0x44,0x0e,0x6a,0x7b,0x62,0x6e,
+0x15,0x01,0x65,0x43,0x66,0xb0,0xcc,0x42,0x45,0xc9,0x28,0x89,0x44,0x9a,0x9b,0xcc,
+0xb4,0xa8,0x03,0x7f,0x7b,0x5a,0x5c,0x94,0x48,0x67,0xfe,0x60,0xc1,0x1a,0x08,0x99,
+0x18,0xcb,0x06,0xbd,0x75,0xff,0x54,0x1d,0x67,0xc5,0x54,0xdf,0x69,0x7c,0x00,0xb2,
+0x0c,0xbb,0x33,0xc4,0xa7,0x3b,0x1a,0x72,0x0c,0x38,0xeb,0x9b,0xb0,0xce,0xb7,0x85,
+0x48,0x9c,0x14,0x9f,0xfd,0x7c,0x5a,0x6e,0x71,0xc4,0xe8,0x31,0x3c,0x30,0x00,0xf9,
+0xb1,0x56,0x93,0xc0,0x8b,0x50,0xe0,0xe6,0x13,0xde,0xdd,0x32,0x72,0xf4,0xba,0xc8,
+0xdc,0xd7,0xa9,0x0a,0xe3,0xa4,0x2a,0x52,0x49,0xb9,0xc2,0xcb,0xf2,0x4c,0x79,0x6d,
+0x41,0x6f,0x82,0xf8,0xdb,0xe6,0x45,0x06,0x03,0x24,0x1f,0x8c,0x2a,0x54,0x23,0xb9,
+0x24,0x43,0x3d,0x41,0xab,0xd0,0x0d,0xd7,0x21,0x42,0x42,0x1d,0x50,0x0b,0xa5,0x06,
+0x3a,0x62,0x3d,0x23,0x5f,0x74,0x98,0x1e,0xff,0xa2,0x2a,0xc1,0x29,0xb5,0x42,0x01,
+0x4e,0xf0,0x94,0xfc,0x16,0x88,0x13,0xa8,0x80,0x59,0xfb,0x54,0x05,0x65,0x09,0x48,
+0x6c,0x05,0x9d,0x0d,0x74,0x4f,0xcb,0xc4,0x3a,0xfc,0xcf,0x54,0xb8,0x67,0xcb,0x25,
+0xb4,0xa3,0xfa,0x9b,0x11,0x94,0xec,0x0f,0x18,0xa6,0x85,0x0d,0xd5,0x9d,0x26,0x34,
+0x86,0x32,0x8e,0x39,0x16,0xff,0x9a,0x54,0xa8,0x8b,0xa8,0x42,0xe2,0xfc,0xa7,0x65,
+0xa9,0xa1,0x51,0x98,0x94,0xfb,0x7a,0x0b,0x91,0xa4,0xaa,0xec,0x19,0xef,0xa3,0xda,
+0xee,0x2e,0x24,0x75,0x24,0x26,0x1c,0xee,0xe3,0xfb,0x50,0x70,0x84,0x77,0x24,0xac,
+0x3d,0xba,0x7a,0x66,0xb9,0xd6,0xe4,0xf3,0xcb,0x8b,0x2b,0xb8,0x1a,0xf9,0x94,0x46,
+0x68,0x8c,0x9d,0xab,0x5a,0x57,0x6f,0x40,0x17,0x3d,0xae,0x81,0x0d,0xf8,0x9b,0xa4,
+0x54,0x0f,0x18,0x8a,0x8b,0x14,0xa7,0x33,0xb6,0x31,0x6c,0x9b,0x1b,0x8c,0x45,0x90,
+0xec,0x8c,0xf6,0xb1,0x50,0xca,0xac,0x72,0xc1,0xac,0xd6,0xff,0xaa,0x90,0xdb,0x71,
+0x25,0x4e,0x66,0xf7,0x88,0x59,0xa6,0x1e,0x26,0xff,0x05,0x7c,0x98,0x64,0x90,0xc6,
+0xdb,0xd3,0x77,0xbf,0x52,0xb4,0x30,0x91,0xd0,0x10,0xa2,0xe2,0xd0,0x37,0x2e,0x4e,
+0x6b,0x8a,0x4c,0xa6,0xf6,0x56,0xb3,0xe2,0x01,0x85,0xf9,0xb5,0xea,0x87,0x43,0xc4,
+0xa3,0x4b,0x8f,0x32,0x72,0xdd,0x26,0x62,0x19,0x35,0xf6,0x31,0x12,0x45,0x39,0x93,
+0x69,0x50,0x24,0xd9,0x45,0x4f,0x3c,0xee,0xe3,0xbf,0x35,0xb2,0x20,0xdf,0xb9,0x87,
+0x24,0xfe,0x0b,0x42,0xc0,0xbd,0x8b,0x72,0x78,0x08,0x41,0x3c,0xa3,0x3a,0xd3,0x1f,
+0x96,0xcf,0xb9,0x8a,0x32,0x67,0x20,0x10,0xf1,0xbb,0x4c,0x34,0xe8,0x66,0xa7,0x75,
+0x7d,0x06,0x89,0x69,0x99,0x7c,0x67,0xc6,0x6d,0x7a,0x97,0x4c,0xfb,0x3b,0x68,0xae,
+0x3d,0xc4,0xc6,0xdc,0x42,0x95,0x11,0x36,0x71,0x04,0x38,0x42,0x43,0xdb,0x36,0xfd,
+0xd4,0xb9,0x96,0xe9,0x3f,0x77,0xfa,0xfd,0x35,0x6c,0x51,0xb7,0x63,0xf1,0xa0,0xb6,
+0x07,0x7b,0x0e,0x0b,0x18,0xfd,0xc7,0x1a,0x16,0x1c,0x7b,0x62,0x54,0xe6,0x13,0x63,
+0x9f,0x50,0x9c,0x2a,0xdb,0x2c,0x6d,0x70,0x97,0x36,0x6b,0x46,0xd0,0x70,0x08,0xee,
+0xc6,0x9a,0xce,0x6d,0x60,0x3b,0xdb,0x76,0x2f,0xc7,0xec,0xc0,0xf6,0xc0,0x7f,0xb8,
+0x00,0x89,0xb3,0xcb,0xbb,0x4d,0x8f,0x37,0xe8,0x98,0x3b,0x16,0x21,0xcc,0x1a,0xb1,
+0xc5,0xcd,0xb0,0xe9,0x85,0x4d,0x51,0x40,0x8b,0xd4,0x07,0x2e,0xb5,0x91,0x5c,0x51,
+0x5b,0x4c,0x10,0xd6,0x6e,0xbf,0xef,0xd3,0xd2,0x86,0x5b,0x17,0xf9,0xfb,0x2e,0x8b,
+0x33,0xbf,0x36,0x59,0xdc,0xc9,0x34,0x8a,0xa0,0xa3,0x07,0x26,0x63,0xd3,0x15,0xb8,
+0x76,0x9a,0xde,0x99,0x93,0x0d,0x84,0xb5,0x66,0xf3,0xb1,0xa8,0xf9,0x67,0xc5,0xf3,
+0xd3,0x5a,0x83,0x48,0x3d,0x73,0x2a,0x20,0x64,0xf5,0xf4,0xd9,0x76,0xf1,0xfc,0x59,
+0x51,0xaa,0xe7,0x74,0xfb,0x06,0x4e,0x89,0x2e,0xc0,0x11,0x50,0x9d,0x17,0x5f,0x91,
+0x7b,0xd7,0xc5,0x4d,0xcb,0xcc,0xa3,0x54,0xc9,0xd2,0x0c,0x93,0xea,0x86,0xbd,0x0e,
+0x1b,0x3c,0x69,0x42,0x5e,0x8f,0x28,0x1c,0x98,0x99,0xc1,0xe2,0xf0,0xc9,0x4c,0x0e,
+0x16,0xe1,0x4d,0x89,0xb5,0xa6,0x1a,0xf0,0x39,0xc6,0xf8,0x2d,0xf8,0x4a,0xce,0xd4,
+0x66,0x70,0x2a,0x0d,0x88,0x03,0xa1,0x10,0xca,0x57,0xae,0xb6,0x85,0xe2,0x7d,0xef,
+0xb6,0xc8,0xee,0x79,0xb5,0xa3,0x74,0xa1,0x0c,0x75,0xe3,0xb5,0x5a,0x4e,0x0f,0x96,
+0x06,0x6e,0xb4,0x5e,0x5f,0x90,0x99,0xb5,0x49,0x5e,0xaa,0x7b,0xc9,0xc2,0xe1,0xca,
+0x58,0xe2,0xdf,0xa4,0x7f,0x28,0xab,0x24,0xda,0x00,0xeb,0x70,0xaf,0xce,0x03,0xed,
+0xa4,0xc7,0x49,0xf4,0xbe,0xc4,0x2e,0x5f,0xfe,0x0d,0x5a,0x57,0x78,0xbb,0x8b,0x58,
+0x8b,0x7b,0xe3,0xec,0x72,0x41,0x05,0xa4,0xb5,0xa0,0x7b,0x63,0xa3,0x41,0x6d,0x0e,
+0x24,0xf8,0x85,0x91,0x6a,0x87,0xa6,0xa5,0x4f,0x9b,0xc1,0x29,0x61,0x71,0x4c,0x93,
+0x87,0x1a,0xcd,0xb7,0x33,0x64,0xdb,0x1e,0xfe,0x7e,0x16,0x35,0x98,0x36,0x56,0xbb,
+0x11,0x81,0xc5,0x86,0xd6,0x28,0x4f,0x53,0x15,0x69,0xd7,0x4f,0x34,0x7b,0x21,0x11,
+0x0e,0x80,0xd6,0xf4,0xd7,0x8c,0xe8,0x78,0x98,0x7c,0x28,0x7e,0x39,0xf9,0xf0,0x1e,
+0x37,0x94,0x48,0x6f,0xc9,0xe8,0x3a,0xa8,0xcf,0x99,0xa0,0x42,0xd1,0x83,0x4f,0x0a,
+0x9e,0x82,0xd9,0x3e,0x12,0x12,0xa3,0x74,0x58,0xa1,0xdd,0xd5,0xe3,0x1c,0x7d,0x83,
+0xb4,0x73,0x61,0x53,0xee,0x16,0xf2,0xa2,0x5d,0x27,0x5f,0x48,0xb4,0xda,0x28,0x8f,
+0x33,0xde,0x44,0x52,0x9f,0x43,0x1e,0xb2,0x2c,0xa9,0x2d,0x6d,0xe6,0x48,0x81,0xb7,
+0x4d,0xc2,0xa3,0xab,0xbd,0x9e,0xb8,0x61,0xb6,0x9e,0x32,0x91,0xb7,0xbd,0xa6,0xbd,
+0x75,0x01,0xaa,0x67,0x03,0x70,0xf7,0x7f,0xab,0x08,0x2b,0x68,0xb2,0x13,0x83,0x8c,
+0x4d,0x64,0x83,0x56,0x9c,0xd6,0x60,0x24,0x5c,0xd9,0xd4,0xe6,0x46,0x25,0x0f,0x99,
+0x9b,0x9b,0x08,0x82,0x55,0x62,0xf1,0x1b,0x7c,0x25,0xa3,0xa0,0x49,0x4b,0xc8,0x4a,
+0x3c,0xee,0xa4,0x30,0x5b,0x97,0x52,0xad,0x22,0xcb,0xf2,0xf8,0x7f,0x26,0x07,0x18,
+0xd0,0x27,0xc5,0xa5,0xa5,0x33,0x8b,0x8e,0x1d,0x90,0xb8,0xb6,0x35,0x1c,0x97,0x6a,
+0x44,0x87,0xb6,0xd7,0x09,0xae,0x65,0xd4,0x22,0xe8,0xde,0x6f,0x48,0x42,0x86,0x43,
+0x30,0x94,0x15,0xe1,0xd6,0x68,0x82,0x20,0x2a,0x54,0xec,0xf6,0x4d,0xc4,0x2c,0x25,
+0xd4,0xb2,0x56,0x6e,0x58,0xa1,0xcc,0xf9,0xca,0x4e,0x24,0xe9,0x55,0xa3,0x35,0xa1,
+0x37,0xb0,0xcb,0xf3,0x79,0x12,0x85,0xd9,0x39,0x4b,0xce,0xd9,0xc7,0x4c,0x65,0x40,
+0x57,0x9d,0x2d,0x6e,0x9c,0x03,0x57,0xb3,0xc2,0x20,0x83,0xf6,0x78,0xde,0x1c,0xa2,
+0xa5,0x86,0x73,0x34,0xc4,0x69,0x3d,0x5e,0x32,0x43,0xff,0x10,0x24,0x96,0xf0,0xc0,
+0xa0,0x0e,0x51,0xdd,0x10,0xf4,0xbe,0x96,0xa8,0x72,0x02,0x9a,0x8b,0xf6,0x0c,0xa6,
+0xf3,0xae,0x38,0x7c,0xbe,0x94,0x82,0xb1,0xdb,0x6d,0xa7,0x15,0xfa,0x36,0x94,0x80,
+0xb6,0x86,0xa2,0xee,0x22,0x11,0x85,0x8c,0x03,0xd2,0xb4,0xb0,0x84,0x06,0x5e,0xdf,
+0x43,0x55,0x90,0x21,0xfc,0xa6,0x49,0xa4,0x82,0xad,0xdd,0xee,0x40,0xb4,0xd4,0xe5,
+0xb0,0x27,0x71,0x6b,0x28,0xb6,0x49,0x51,0x00,0x5a,0xd0,0x35,0xb6,0x6b,0x86,0x6b,
+0x47,0xf1,0xb7,0x49,0x9d,0xfe,0x06,0x67,0x31,0xad,0xaf,0x2d,0x95,0x4c,0xd1,0x8a,
+0x4c,0x70,0xe3,0xa1,0x65,0x88,0xbd,0xa7,0x9e,0xd7,0xf3,0x8a,0xb9,0xf9,0x9b,0x5e,
+0xc1,0xe0,0x4c,0x93,0x02,0x9f,0x3b,0x8f,0x77,0x50,0x29,0xff,0xf8,0xe4,0x49,0x1f,
+0x1b,0x99,0x2e,0x1a,0x88,0x3f,0xc9,0xca,0xf9,0x0b,0xad,0x96,0xf7,0x94,0x33,0x07,
+0x40,0xa0,0x42,0xac,0xee,0x3e,0x7a,0xeb,0xdd,0xfa,0x03,0x97,0x33,0x6a,0x02,0xda,
+0x09,0x83,0x63,0x69,0x21,0xcb,0x4a,0x35,0x20,0x83,0x4e,0x1d,0x79,0x5d,0x14,0xfe,
+0xc9,0x85,0x65,0x9a,0xa9,0x3a,0x3d,0xb7,0xf2,0x29,0xd9,0x68,0x0e,0x9f,0x4a,0xf3,
+0x8b,0xc0,0xfb,0xe4,0x58,0x9b,0xcb,0x4a,0xa8,0x49,0xa1,0xaf,0x43,0xaf,0xdb,0x68,
+0x8b,0xe6,0x61,0x71,0x2c,0xa2,0xaa,0x12,0x55,0x9a,0xcf,0xd3,0x6b,0x1a,0x41,0x4c,
+0xd0,0xad,0x5c,0x50,0x7d,0x4b,0x6e,0x67,0x93,0x32,0xf5,0x53,0x23,0x9a,0x18,0x91,
+0x8d,0xbf,0x3e,0xf9,0xb8,0xb7,0xdb,0xc8,0x9e,0x5c,0xf4,0xd5,0xc9,0x49,0x00,0x2c,
+0xef,0xc9,0x92,0x6f,0x3a,0x6b,0xb4,0x56,0xbd,0xbc,0x3e,0x95,0x17,0xb4,0x1f,0x78,
+0x63,0x45,0x83,0x9a,0xb3,0xfe,0x39,0xca,0x4d,0x14,0x97,0xfa,0x28,0xfe,0x2a,0xa9,
+0xa9,0xa0,0xba,0x33,0xe8,0x78,0x43,0x85,0x4b,0x14,0x7a,0x39,0x7a,0x14,0x7b,0x96,
+0x26,0xd9,0x25,0x34,0x94,0x1e,0x7e,0xf1,0x38,0x56,0x54,0x63,0xa5,0xf4,0x17,0x4f,
+0x90,0xeb,0x63,0x8d,0x4c,0xca,0x5e,0x8c,0x5f,0x1e,0x36,0xb6,0x9f,0x7b,0x8e,0xb7,
+0x77,0x79,0x2c,0x53,0xf6,0xfb,0x09,0xfd,0xba,0xc3,0xf1,0xbd,0xc9,0x35,0x03,0xbb,
+0x30,0x37,0xbc,0x73,0x90,0xe7,0x6a,0x52,0x03,0x5b,0x15,0x72,0x03,0x30,0x98,0x7e,
+0x95,0x4a,0x43,0x5d,0xe0,0x21,0x39,0x56,0x8a,0xf9,0xb6,0x2f,0x4a,0x4c,0x13,0x9a,
+0x05,0xba,0x8c,0xda,0x08,0xe0,0x61,0x9b,0x58,0x3b,0x0b,0x64,0xd3,0xe6,0x23,0x77,
+0xc5,0x4c,0xc2,0xf1,0x9d,0x87,0x6d,0x74,0xbe,0x75,0xc1,0x75,0xcd,0x69,0x9e,0xea,
+0xb8,0xb8,0xc5,0x1f,0xb6,0xe4,0xa7,0xe4,0xc2,0x68,0xef,0x83,0x9f,0xfe,0x40,0x6c,
+0xa7,0xf0,0x15,0x64,0xfd,0x60,0x81,0x36,0x42,0x5c,0x47,0xf5,0x42,0xea,0xb1,0xb1,
+0x78,0x0e,0xed,0xe2,0xaf,0xbf,0xc4,0xca,0x1e,0x4c,0x27,0x4a,0xa7,0x31,0x02,0x9a,
+0x37,0x52,0xc8,0x73,0xd0,0x88,0xe7,0x82,0x54,0xed,0x12,0x1d,0xf8,0xfd,0x1e,0x4f,
+0x0a,0x36,0xdd,0xeb,0x6c,0xd7,0xdf,0x36,0x13,0xe1,0xe4,0x4f,0x15,0xc2,0x9c,0x5e,
+0xcc,0x0e,0xf7,0xe2,0x83,0x27,0xa3,0x9d,0x27,0x7b,0xa3,0x1f,0x0f,0xfa,0xfb,0x8f,
+0x76,0x0f,0xf8,0x99,0x8e,0x47,0x0f,0xf7,0x42,0x57,0x5d,0x22,0x2f,0x50,0x82,0x33,
+0xd8,0x76,0x46,0x7b,0xfb,0x7b,0x12,0xff,0xed,0xec,0xee,0xc7,0xfb,0xfd,0x91,0xc5,
+0xf6,0xe4,0xbe,0xd8,0x58,0xa8,0x96,0xb0,0x83,0xc7,0xf1,0xde,0xc1,0xa3,0x9d,0xfd,
+0x83,0xa1,0x7a,0xdc,0x3f,0xd8,0xb7,0xa8,0x76,0x76,0x19,0x97,0x20,0x97,0x8e,0xf4,
+0x54,0xa6,0x70,0x66,0x2e,0x4c,0x79,0xc2,0xcd,0xaf,0x0e,0xbc,0x49,0x73,0xec,0x84,
+0x19,0x35,0x05,0x55,0xf3,0x26,0x45,0x6f,0x1a,0xb4,0x34,0x2d,0x62,0xf2,0x7e,0x4e,
+0xb8,0xf4,0x6c,0x15,0xac,0xcb,0xba,0x2d,0xf9,0x1b,0x78,0x6f,0xfd,0x0b,0xd4,0xe2,
+0xf3,0x95,0x1d,0x37,0x6e,0x7e,0x08,0x7b,0xc0,0x7d,0xa2,0x79,0xc6,0xe5,0x5a,0xd1,
+0x6c,0x08,0x04,0xe0,0x8a,0xea,0x42,0x1a,0x9b,0xaa,0x4c,0x0e,0xed,0xb8,0xc1,0x12,
+0x6e,0x6a,0x09,0x76,0xc6,0x2c,0xd7,0x48,0x2e,0x77,0xa5,0x78,0x8b,0x72,0xcb,0x40,
+0x92,0xf4,0xf8,0xe1,0x26,0xa3,0xe1,0x38,0x50,0x32,0x6d,0xcb,0xef,0x02,0x9b,0x9e,
+0x5e,0x06,0x0b,0x47,0x2b,0x54,0x6a,0xa9,0xda,0x1a,0x25,0x2a,0x8d,0xcd,0x88,0xdb,
+0x3e,0x11,0x6e,0x7a,0x3b,0x58,0x4e,0x61,0x04,0x13,0x2c,0x34,0x70,0x76,0x6e,0x4e,
+0xed,0x2f,0x39,0xe5,0xfa,0x23,0x1c,0x5e,0xf2,0xe1,0xd7,0xe6,0x41,0x8e,0xa7,0xeb,
+0x58,0x71,0xf5,0x82,0x5b,0x7d,0x6f,0xf2,0x08,0xfd,0x0c,0xe1,0xa0,0x09,0x8a,0xc9,
+0x2f,0x5f,0x3c,0x7e,0x9d,0x5b,0xd8,0xa4,0x9f,0x67,0xee,0x87,0x7b,0xf4,0xdd,0x12,
+0x3b,0x88,0x5c,0x1b,0x63,0x22,0x81,0x73,0xa1,0x02,0x62,0xdb,0x63,0x04,0x87,0xc6,
+0x50,0xa1,0xae,0xb4,0xca,0x2a,0xfb,0xd6,0xe3,0x2e,0x80,0xa4,0xd1,0x43,0x04,0xab,
+0x17,0x3e,0xb2,0x21,0xf6,0x3f,0x7e,0x5d,0xe1,0x2b,0xcb,0x32,0x2f,0xef,0x3a,0xc8,
+0x00,0x76,0x0e,0x72,0x82,0x20,0x90,0xd2,0xbf,0xab,0xa0,0xf7,0x11,0xf3,0x36,0x42,
+0xe3,0x76,0x92,0x28,0x87,0xa4,0x0a,0x1d,0x0b,0xb4,0x0b,0xcf,0xd2,0x68,0x4c,0x4c,
+0x43,0xd3,0xfc,0x23,0x96,0x3f,0x84,0xe9,0x85,0xd8,0x4e,0x79,0x22,0x59,0xb3,0x6b,
+0x0f,0x0e,0x95,0xf0,0xc2,0x61,0x92,0x79,0x1c,0xf2,0x6a,0x8e,0x6b,0x6f,0x6a,0x70,
+0x3d,0xf4,0xfe,0x30,0x3e,0xd5,0x12,0xd9,0xa1,0x3d,0x4c,0x9a,0x6e,0xde,0x33,0x4a,
+0x35,0xc9,0x67,0xaa,0xf5,0x62,0x86,0xe8,0x4b,0x2e,0xc2,0x12,0x60,0xe6,0x36,0x47,
+0x65,0x57,0x35,0x6c,0x00,0x6b,0x75,0x25,0xff,0x06,0x17,0xc2,0x9e,0x0c,0x51,0x24,
+0x00,0x00
+};
+
+// /index.html
+const char* const data_index_html_path PROGMEM = "/index.html";
+const char* const data_index_html_etag PROGMEM = "\"b7a64334df3c6e7d\"";
+const size_t data_index_html_len = 1197;
+const uint8_t data_index_html[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xad,0x57,0x5d,0x6f,0xdb,0x36,
+0x14,0x7d,0xcf,0xaf,0x60,0x59,0xa0,0x68,0xb1,0xd2,0x72,0xe2,0x25,0x4b,0x13,0x5b,
+0xc3,0xd6,0x74,0xd8,0x80,0x66,0xcb,0x66,0x0f,0xc3,0x9e,0x06,0x5a,0xa4,0x2d,0x36,
+0x14,0xa9,0x92,0x94,0x1c,0xff,0xfb,0x5d,0x92,0x92,0x2c,0x3b,0x76,0xd2,0xa4,0x7d,
+0xb1,0xf8,0x75,0x0f,0xcf,0xbd,0xf7,0x90,0x97,0x1e,0xbf,0xb8,0xfa,0xe3,0xfd,0xec,
+0xdf,0x9b,0x0f,0xe8,0xd7,0xd9,0xf5,0xc7,0x74,0x9c,0xbb,0x42,0xa6,0x47,0xe3,0x9c,
+0x53,0x06,0x9f,0x82,0x3b,0x8a,0x72,0xe7,0x4a,0xc2,0x3f,0x57,0xa2,0x9e,0xe0,0xf7,
+0x5a,0x39,0xae,0x1c,0x99,0xad,0x4b,0x8e,0x51,0x16,0x7b,0x13,0xec,0xf8,0x9d,0x4b,
+0xbc,0xe9,0x25,0xca,0x72,0x6a,0x2c,0x77,0x93,0xca,0x2d,0xc8,0x39,0x46,0x49,0x8b,
+0xa2,0x68,0xc1,0x27,0xb8,0x16,0x7c,0x55,0x6a,0xe3,0x7a,0xb6,0x2b,0xc1,0x5c,0x3e,
+0x61,0xbc,0x16,0x19,0x27,0xa1,0xf3,0x16,0x09,0x25,0x9c,0xa0,0x92,0xd8,0x8c,0x4a,
+0x3e,0x39,0xee,0xc1,0x6c,0x91,0xa1,0x59,0xce,0x89,0xa7,0x64,0xb4,0xec,0x21,0x2a,
+0x4d,0x32,0x3f,0xf5,0x16,0x41,0xcb,0x3a,0x6d,0xa0,0x55,0x54,0xd6,0x11,0xc3,0x6b,
+0x2a,0x05,0xa3,0x8e,0x1f,0x40,0xbc,0x31,0x74,0x59,0xd0,0x3d,0x50,0x07,0xd6,0x7f,
+0xb8,0x2b,0x85,0xe1,0xb6,0x67,0x30,0x8c,0x2b,0x9d,0x70,0x92,0xa7,0x57,0xe0,0x12,
+0x22,0xe8,0x27,0x56,0x80,0x43,0xd6,0x19,0xea,0x84,0x56,0xe3,0x24,0x4e,0x1e,0x8d,
+0x93,0x26,0xca,0x73,0xcd,0xd6,0xf0,0x61,0xa2,0x46,0x82,0x4d,0xb0,0xd4,0x94,0x09,
+0xb5,0x9c,0x3a,0x0a,0x71,0x4a,0x3f,0xc6,0xde,0x60,0x30,0x18,0x27,0xb0,0xa2,0xb7,
+0xae,0xa0,0x42,0x61,0x64,0xdd,0x1a,0x42,0x84,0x99,0xb0,0xa5,0xa4,0xeb,0x0b,0x70,
+0x59,0xf1,0x4b,0xdc,0x2c,0xcb,0x24,0xb5,0xb6,0x43,0xc4,0x1d,0x3c,0x37,0x8f,0x18,
+0x36,0x93,0x05,0x35,0x4b,0xa1,0x88,0xe4,0x0b,0x77,0x81,0xc8,0xc9,0x69,0x79,0x77,
+0x80,0x50,0xfa,0xea,0xe5,0xf9,0xc9,0x68,0x78,0xd9,0x0e,0xf5,0xa8,0x76,0x1c,0x96,
+0x1a,0xd0,0x7d,0x48,0x8e,0x76,0x3d,0xf1,0x71,0x00,0x4a,0xdb,0x06,0x46,0xaf,0xfc,
+0x48,0x7e,0x1a,0xc2,0x08,0xc1,0x3a,0xdd,0xe0,0xee,0xd8,0x5b,0xc1,0xf8,0x9c,0x06,
+0x00,0xda,0x9a,0xcf,0x2b,0xe7,0xb4,0x42,0xab,0xe3,0x21,0xa4,0x24,0x37,0x7c,0x31,
+0xc1,0x09,0x4e,0x73,0x5d,0x00,0x14,0x7d,0x6c,0x61,0x55,0x06,0x91,0xa4,0xf1,0x1b,
+0x0d,0x5e,0x10,0xb2,0xd7,0x08,0xc5,0x36,0x61,0x54,0x2d,0x7d,0x5c,0x3d,0x21,0xd0,
+0x04,0x77,0x2d,0xda,0x4b,0x9c,0x86,0xbe,0x87,0x21,0x64,0xdb,0xc9,0x9a,0x1b,0x0b,
+0x9a,0x88,0x56,0x6d,0x27,0xad,0x87,0x83,0xb3,0x21,0x08,0x67,0xf4,0x6e,0xd7,0xd3,
+0x85,0xd6,0xae,0x8b,0x54,0x0a,0x7c,0xe2,0x16,0x5e,0x93,0xf6,0x22,0x49,0x96,0xc2,
+0xe5,0xd5,0x7c,0x90,0xe9,0x22,0x31,0x9c,0xd1,0xdb,0x5b,0x6e,0x12,0x8c,0x40,0x48,
+0x4b,0x38,0x91,0xf8,0xbf,0xb9,0xa4,0xea,0xd6,0xb3,0x89,0x53,0x9e,0xd0,0x4e,0x44,
+0x77,0xb6,0x6b,0x64,0xbd,0x93,0x19,0x3f,0x4a,0x45,0xa4,0x01,0x51,0x41,0xb3,0x9c,
+0xa3,0x6b,0xcd,0xa8,0x44,0x9d,0x7b,0x41,0x9f,0xeb,0x30,0x88,0x5b,0xb3,0x22,0xf6,
+0x0e,0xea,0xce,0x43,0x45,0x98,0x66,0x5b,0xb4,0x1b,0xad,0x80,0x40,0x7a,0xa4,0x6c,
+0x49,0x55,0xc7,0x4a,0x6a,0x0b,0x29,0x7b,0xe5,0x44,0xc1,0x2d,0x08,0xd1,0xcf,0xc1,
+0x92,0x32,0x9d,0x42,0xce,0x91,0xbf,0xa1,0xe0,0x5a,0x41,0xae,0xe5,0xea,0xe5,0x5b,
+0xee,0x75,0x7c,0x5b,0x7f,0x0b,0x6d,0x8a,0xe0,0x0e,0x28,0x81,0xfa,0xce,0x1e,0x99,
+0xb6,0x3e,0x95,0xda,0x0a,0x7f,0xc4,0x2f,0x90,0xe1,0x12,0x0e,0x7b,0xcd,0xa3,0x82,
+0xdb,0xb5,0x4b,0xc3,0xd7,0x90,0xb1,0xb9,0x36,0x41,0xee,0xbf,0x73,0xb7,0xd2,0xe6,
+0x16,0x81,0x36,0x1c,0x9c,0x28,0xdb,0x68,0xbc,0x07,0x0e,0xa4,0x0d,0x5d,0x54,0x2a,
+0x43,0x65,0x25,0x25,0x31,0x62,0x99,0xbb,0xe0,0x0a,0x59,0x51,0xa3,0xc0,0x06,0xe5,
+0x54,0xb1,0xa8,0x1e,0xca,0x6a,0xaa,0x32,0xce,0x94,0x57,0x9e,0x56,0x99,0x14,0xd9,
+0xed,0x66,0xf4,0xf5,0x1b,0x9c,0xb6,0x6d,0xf4,0xdd,0x1e,0x77,0x9f,0xb2,0xd5,0x9c,
+0x5a,0x91,0x85,0x7d,0xf6,0x25,0xf3,0xc0,0xee,0xc1,0x08,0x91,0x47,0x03,0xde,0x1b,
+0xb1,0xe2,0x0e,0xb4,0x20,0xab,0x42,0x59,0x3f,0x23,0xe9,0x9c,0x4b,0x04,0x39,0x80,
+0x19,0x38,0xf2,0x38,0xfd,0x47,0xfc,0x22,0x42,0x61,0x19,0x27,0x61,0x0e,0xd6,0x08,
+0x55,0x56,0xc0,0x1b,0xca,0x53,0xac,0x4a,0x9d,0xfa,0x2a,0xb2,0xf0,0x7e,0x85,0x02,
+0x83,0x9b,0x6a,0x14,0x50,0xe2,0x0d,0x12,0x5a,0xe0,0x43,0xc6,0x73,0x2d,0x21,0x3b,
+0x13,0x3c,0x9d,0xfe,0x76,0x85,0xf7,0x12,0x3d,0x4c,0xab,0x04,0x0f,0x6e,0x60,0x0d,
+0xa4,0x95,0xed,0xe7,0x54,0x36,0xb3,0x0f,0xf2,0x02,0x98,0xc0,0xca,0x7f,0xb7,0x38,
+0xb5,0xd8,0xf8,0x0b,0x84,0xfb,0x45,0x84,0x8b,0xcf,0xce,0x59,0x6e,0x6a,0x2f,0xc7,
+0xeb,0x3f,0x67,0x33,0x14,0x3b,0xcf,0x8c,0x67,0x0f,0x2d,0xde,0x00,0xbd,0xfe,0x96,
+0x1f,0xbd,0xad,0x10,0x65,0x0c,0xae,0x47,0xbb,0x3f,0xd4,0x0e,0xee,0x37,0xfe,0x00,
+0xf7,0xf0,0x96,0x88,0xcc,0x7d,0xf3,0xc9,0xbc,0xe1,0x3d,0x50,0xc1,0x8a,0xe3,0xf3,
+0xf3,0x51,0xdf,0x89,0xf8,0x44,0x69,0x5d,0x88,0xbd,0x83,0x0e,0x6c,0x78,0x3c,0xcb,
+0x03,0xb8,0xc0,0x05,0x94,0xd5,0x9f,0xa9,0x85,0x5b,0x4a,0x97,0x22,0xfb,0x8a,0xe0,
+0x37,0x60,0x1b,0xe6,0x4d,0xff,0x3e,0xf7,0xb0,0x13,0x6a,0x37,0xff,0x86,0x6a,0xaa,
+0xac,0xd7,0xd2,0xdf,0xf0,0xfb,0x15,0x07,0xb3,0x03,0xea,0x3c,0x89,0xbd,0x2d,0x3f,
+0xda,0x3d,0x9e,0x7a,0x48,0x43,0x60,0xbe,0xcd,0x41,0x6d,0xa0,0x36,0xf1,0xfe,0x9a,
+0x03,0xdb,0xa3,0x68,0xf8,0x1c,0x0a,0x3d,0x4e,0xff,0x0a,0x5f,0x44,0x17,0x50,0xf4,
+0xd1,0xeb,0x5c,0x57,0xc6,0xbe,0x79,0x66,0x48,0x1b,0xc8,0xe6,0x79,0x12,0xdb,0x5b,
+0x54,0x77,0xb2,0x1c,0xc0,0xe1,0x21,0x51,0x84,0x52,0xfb,0x14,0xf2,0x0c,0x5e,0xc9,
+0x42,0x72,0xf0,0xf9,0xaa,0x69,0x41,0x39,0xdc,0x3e,0x9d,0x96,0x4b,0x9e,0xb9,0x87,
+0xe8,0x76,0x20,0xb1,0xf6,0x76,0x90,0x47,0x63,0x5d,0xfa,0x12,0xdb,0x9e,0xdc,0x21,
+0xec,0xa2,0xa1,0xec,0x38,0x38,0x8d,0x0a,0x52,0x19,0x67,0xef,0x2d,0x3b,0xc6,0xe9,
+0x74,0x7b,0x3e,0x89,0x1c,0x1e,0x72,0xda,0x5b,0xa0,0x76,0x6b,0x14,0x8e,0x4d,0x74,
+0x64,0xf0,0x70,0x38,0xda,0xaa,0x98,0x73,0x5f,0x44,0x2f,0xd0,0x68,0x58,0xde,0x5d,
+0x6e,0x62,0x18,0xd3,0xb6,0xf5,0x90,0x24,0xa5,0x11,0xf0,0xd6,0x5e,0xe3,0x26,0x9b,
+0x71,0xb4,0xbb,0x9e,0xa6,0xd5,0xbc,0x10,0x4d,0xee,0x2c,0xad,0x79,0x3b,0xdd,0xd5,
+0x59,0x3f,0xe8,0x6b,0x2c,0x30,0xf2,0x4f,0x94,0x7b,0x62,0x6b,0x3e,0x36,0x33,0xa2,
+0xec,0x2b,0x26,0xf9,0x44,0x6b,0x1a,0x47,0x81,0xb5,0xc9,0xe0,0xe9,0xeb,0x9f,0x00,
+0x3e,0x44,0x76,0xf0,0xc9,0xfe,0x58,0x4f,0x16,0x6c,0x71,0x3a,0x3a,0x3b,0x1e,0x9d,
+0x9c,0x7c,0xff,0x8e,0x9d,0xfd,0xc0,0xbd,0x1b,0xd1,0xa0,0x87,0xde,0xfc,0x81,0x49,
+0xe2,0x9f,0xc7,0xff,0x01,0x78,0x89,0x86,0xa7,0x53,0x0e,0x00,0x00
+};
 
-)=====";
+// /update.html
+const char* const data_update_html_path PROGMEM = "/update.html";
+const char* const data_update_html_etag PROGMEM = "\"f254c855cc5298dc\"";
+const size_t data_update_html_len = 992;
+const uint8_t data_update_html[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x8d,0x56,0x4d,0x73,0xdb,0x36,
+0x10,0xbd,0xfb,0x57,0xc0,0xc8,0x4c,0x26,0x99,0x09,0x44,0x7f,0xd4,0x6e,0x62,0x4b,
+0xec,0x74,0x9c,0x64,0x7a,0x48,0x5a,0xcf,0xc4,0x3d,0xf4,0xd4,0x01,0xc9,0x95,0x08,
+0x0b,0x04,0x50,0x60,0x29,0x59,0xff,0xbe,0x0b,0x82,0xa4,0x29,0xc5,0x6a,0x7a,0x11,
+0x09,0x60,0x3f,0xde,0xbe,0x7d,0x58,0x6a,0x7e,0xfa,0xf1,0x8f,0xbb,0x87,0xbf,0xee,
+0x3f,0xb1,0xdf,0x1e,0xbe,0x7e,0xc9,0xe7,0x35,0x36,0x3a,0x3f,0x99,0xd7,0x20,0x2b,
+0x7a,0x34,0x80,0x92,0xd5,0x88,0x4e,0xc0,0x3f,0xad,0xda,0x2c,0xf8,0x9d,0x35,0x08,
+0x06,0xc5,0xc3,0xce,0x01,0x67,0x65,0x5a,0x2d,0x38,0xc2,0x13,0x66,0xd1,0xf5,0x96,
+0x95,0xb5,0xf4,0x01,0x70,0xd1,0xe2,0x52,0xbc,0xe7,0x2c,0x1b,0xa2,0x18,0xd9,0xc0,
+0x82,0x6f,0x14,0x6c,0x9d,0xf5,0x38,0xf1,0xdd,0xaa,0x0a,0xeb,0x45,0x05,0x1b,0x55,
+0x82,0xe8,0x16,0xef,0x98,0x32,0x0a,0x95,0xd4,0x22,0x94,0x52,0xc3,0xe2,0x7c,0x12,
+0x66,0x0f,0x8c,0x2c,0x6b,0x10,0x11,0x92,0xb7,0x7a,0x12,0xd1,0x58,0x51,0xc6,0xa3,
+0x77,0x8c,0xde,0x02,0x5a,0x4f,0x6f,0x4d,0x1b,0x50,0x78,0xd8,0x48,0xad,0x2a,0x89,
+0x70,0x24,0xe2,0xbd,0x97,0xab,0x46,0xbe,0x10,0xea,0x88,0xfd,0xa7,0x27,0xa7,0x3c,
+0x84,0x89,0xc3,0x59,0xb2,0x44,0x85,0x1a,0xf2,0x8f,0x54,0x12,0x13,0xec,0xd7,0xaa,
+0xa1,0x82,0x02,0x7a,0x89,0xca,0x9a,0x79,0x96,0x0e,0x4f,0xe6,0x59,0xcf,0x72,0x61,
+0xab,0x1d,0x3d,0x2a,0xb5,0x61,0xaa,0x5a,0x70,0x6d,0x65,0xa5,0xcc,0xea,0x1b,0x4a,
+0xe2,0x29,0xff,0x92,0x56,0xb3,0xd9,0x6c,0x9e,0x91,0xc5,0xc4,0xae,0x91,0xca,0x70,
+0x16,0x70,0x47,0x14,0xf1,0x4a,0x05,0xa7,0xe5,0xee,0x86,0x4a,0x36,0x70,0xcb,0x7b,
+0xb3,0x52,0xcb,0x10,0xc6,0x88,0x7c,0x0c,0x0f,0xfe,0x07,0x8e,0xfd,0x61,0x23,0xfd,
+0x4a,0x19,0xa1,0x61,0x89,0x37,0x4c,0x5c,0x5c,0xb9,0xa7,0x23,0x80,0xf2,0xd7,0xaf,
+0xde,0x5f,0x5c,0x9e,0xdd,0x0e,0x5b,0x13,0xa8,0x23,0x86,0x95,0xa5,0xe8,0x91,0x92,
+0x93,0xc3,0x4a,0x22,0x0f,0x04,0x69,0xdf,0xc1,0xdb,0x6d,0xdc,0xa9,0xaf,0x3a,0x1a,
+0x89,0xac,0xab,0xe7,0xb8,0x07,0xfe,0x41,0x55,0x50,0xc8,0x2e,0x80,0x1c,0xdc,0x8b,
+0x16,0xd1,0x1a,0xb6,0x3d,0x3f,0xa3,0x96,0xd4,0x1e,0x96,0x0b,0x9e,0xf1,0xbc,0xb6,
+0x0d,0x85,0x92,0x3f,0x32,0x6c,0x5d,0x27,0x92,0x3c,0x3d,0x93,0xc3,0xa9,0x10,0x2f,
+0x3a,0xb1,0xf4,0x2e,0x2a,0x69,0x56,0x91,0xd7,0x08,0x88,0x34,0x01,0x38,0x44,0x7b,
+0xc5,0xf3,0x6e,0x1d,0xc3,0x08,0xb1,0x5f,0xe4,0x06,0x7c,0x20,0x4d,0x24,0xaf,0x61,
+0x91,0x6f,0xce,0x66,0xd7,0x67,0x24,0x9c,0xcb,0x0f,0x87,0x95,0x2e,0xad,0xc5,0x91,
+0xa9,0x9c,0xf0,0xa4,0x14,0x51,0x93,0xe1,0x26,0xcb,0x56,0x0a,0xeb,0xb6,0x98,0x95,
+0xb6,0xc9,0x3c,0x54,0x72,0xbd,0x06,0x9f,0x15,0x1a,0xca,0x75,0x04,0x46,0x7a,0x5a,
+0xd1,0xc5,0xe4,0x7f,0x17,0x5a,0x9a,0x35,0xcf,0xfb,0x83,0x08,0xeb,0x80,0xd7,0x83,
+0xa4,0xbd,0xb8,0x0f,0xfa,0x13,0x77,0xa5,0x4a,0x60,0x88,0x1b,0xf6,0x50,0x03,0xfb,
+0x6a,0x2b,0xa9,0xd9,0x58,0x64,0xa7,0xd2,0x5d,0xb7,0xc9,0x07,0xb7,0x26,0xad,0x8e,
+0xaa,0x2f,0x86,0x4a,0x61,0xfa,0xb4,0xec,0x90,0xb3,0x2e,0x82,0x98,0x80,0x0a,0x4e,
+0x9a,0x11,0x95,0xb6,0x81,0x1a,0xf7,0x1a,0x55,0x03,0x81,0xe4,0x18,0xcf,0xc8,0xc4,
+0xe5,0xdf,0xa8,0xf3,0x2c,0xce,0x29,0x1a,0x2e,0x0c,0x07,0xac,0x51,0xc4,0xee,0xbb,
+0xc2,0x5d,0x52,0x55,0xeb,0xe2,0xa8,0x12,0xc6,0x22,0x09,0x90,0xe7,0xf7,0x1a,0x64,
+0x00,0x56,0x90,0x30,0xe9,0xb1,0xb3,0xad,0x67,0x49,0x1f,0x6c,0xa9,0x34,0xfd,0x78,
+0xdb,0xa4,0xdd,0x34,0xcb,0x66,0xf3,0xc2,0xc7,0x59,0x70,0x57,0x13,0xcd,0x6c,0x69,
+0x3d,0x33,0xb0,0x85,0x3d,0x9f,0xc0,0x6c,0xc2,0xe2,0xbc,0x7d,0x84,0x12,0x99,0x07,
+0x67,0x83,0xa2,0x89,0xb5,0x63,0xff,0xab,0xb7,0xcf,0x4d,0xed,0x7b,0xfa,0x5f,0xc6,
+0xb1,0xd1,0x6c,0x0b,0x05,0x25,0x80,0xbe,0x6c,0x37,0xd0,0x16,0x89,0xd9,0x53,0x30,
+0x78,0x6f,0x8f,0x0f,0x89,0xd8,0xeb,0xb2,0x26,0xa6,0x4d,0xaa,0x5d,0x85,0x58,0x42,
+0x21,0x0b,0xbd,0x23,0x13,0x64,0x92,0x75,0x83,0x76,0x5a,0x6b,0x9f,0x91,0x78,0x68,
+0x98,0x2c,0xe3,0x20,0xec,0xee,0xd9,0xca,0xd3,0xd5,0xe7,0x8c,0x26,0x6b,0x6d,0x29,
+0x2d,0x95,0x4f,0xf7,0x06,0x4c,0x89,0xf4,0x81,0xa1,0x56,0xb7,0x1a,0x95,0xa3,0x39,
+0x98,0x45,0x3f,0x02,0x88,0x92,0xf7,0xf7,0x80,0x96,0xaa,0x8a,0xdd,0xd7,0xb2,0x00,
+0x1d,0xf9,0xa5,0x5d,0xca,0x23,0x5a,0x17,0x27,0x5c,0x32,0x2b,0x69,0xea,0xdb,0x46,
+0xec,0xed,0x0f,0x42,0x79,0xe1,0xc8,0x9a,0x52,0xab,0x72,0xbd,0xe0,0x44,0xe9,0x67,
+0x3a,0x78,0xf3,0x36,0x26,0x50,0xc6,0xb5,0x98,0xb2,0x46,0x63,0xca,0xca,0x12,0xba,
+0xb8,0xe4,0xfd,0x87,0x8d,0xfa,0x2e,0xd2,0x9a,0x82,0xd4,0x91,0xc8,0x31,0xca,0xef,
+0x64,0xf0,0x06,0x6b,0x15,0xde,0xf2,0x6c,0x50,0xeb,0x10,0xad,0x8b,0x3d,0x62,0xe2,
+0xf9,0x5d,0x6d,0x89,0x55,0xe2,0x2f,0x1e,0x9e,0x8e,0xf2,0xcd,0xba,0x22,0x47,0x2c,
+0x29,0x7d,0x9a,0x3b,0x3c,0x52,0xdd,0xd2,0xf2,0xcf,0x49,0xdd,0xa9,0x20,0xd1,0x4f,
+0xa6,0x88,0x98,0x3a,0x48,0xdd,0x81,0xaa,0xeb,0x65,0xf7,0x96,0x3e,0x54,0x6e,0x6a,
+0x1f,0x50,0x62,0x1b,0x78,0x3e,0x88,0x23,0x1e,0x51,0x5f,0x57,0x34,0xbe,0x9e,0x77,
+0x3d,0x0c,0x23,0x8e,0x9a,0xd3,0xed,0xfa,0xee,0x63,0x16,0x5b,0xf2,0xdd,0x4d,0x0a,
+0xa5,0x57,0x6e,0x00,0xdc,0xfd,0x4b,0x78,0x94,0x1b,0x99,0x76,0x49,0x5d,0xbe,0x24,
+0x11,0x2c,0x5b,0xd3,0xe9,0x21,0xcc,0x1e,0xc3,0x2f,0x9b,0xc5,0xb2,0x5a,0x5e,0x5d,
+0x5e,0x9f,0x5f,0x5e,0x5c,0xfc,0xf4,0xa1,0xba,0xfe,0x19,0x62,0x8a,0xe4,0x30,0x89,
+0xde,0x7f,0x32,0xb3,0xf4,0x77,0xe5,0x5f,0x0e,0xe2,0xd2,0x2c,0xc5,0x08,0x00,0x00
+};
 
@@ -7,6 +7,10 @@
 #include <Update.h>
 #include "database.cpp"
 #include "log.cpp"
+#include "metrics.cpp"
+#include "boot.cpp"
+#include <stdarg.h>
+#include <esp_timer.h>
 #include "webcontent.h"
 
 class Webserver {
@@ -19,6 +23,13 @@ class Webserver {
     //InternalStorageClass* InternalStorage;
     EspClass* ESP;
 
+    // The /metrics response is streamed from this buffer
+    char metricsBuffer[METRICS_BUFFER_SIZE];
+    size_t metricsLength = 0;
+
+    // Largest heap usage of an asset request (bytes)
+    uint32_t assetHeapPeak = 0;
+
     public:
         Webserver (Log &log){
             this -> rlog = &log;
@@ -32,34 +43,39 @@ class Webserver {
             this->database = &database;
 
             // -- Set up required URL handlers on the web server.
-            // We should bind the member function in this way to able to pass to the request function.
-            // https://stackoverflow.com/questions/43479328/how-to-pass-class-member-function-as-handler-function
-            server.on("/", std::bind(&Webserver::handleRoot, this));
+            // The handlers are wrapped by counted(), so every request is counted in one place.
+            server.on("/", counted(&Webserver::handleRoot));
 
-            server.on(data_functions_js_path, HTTP_GET, std::bind(&Webserver::handleJavaScript, this));
-            server.on(data_style_css_path, HTTP_GET, std::bind(&Webserver::handleStyle, this));
-            server.on(data_normalize_css_path, HTTP_GET, std::bind(&Webserver::handleNormalize, this));
-            server.on(data_skeleton_css_path, HTTP_GET, std::bind(&Webserver::handleSkeleton, this));
-            //server.on("/logo.jpg", HTTP_GET, std::bind(&Webserver::handleLogo, this));
+            server.on(data_functions_js_path, HTTP_GET, counted(&Webserver::handleJavaScript));
+            server.on(data_style_css_path, HTTP_GET, counted(&Webserver::handleStyle));
+            server.on(data_normalize_css_path, HTTP_GET, counted(&Webserver::handleNormalize));
+            server.on(data_skeleton_css_path, HTTP_GET, counted(&Webserver::handleSkeleton));
+            //server.on("/logo.jpg", HTTP_GET, counted(&Webserver::handleLogo));
 
-            server.on("/data", std::bind(&Webserver::handleData, this));
+            server.on("/data", counted(&Webserver::handleData));
+            server.on("/metrics", HTTP_GET, counted(&Webserver::handleMetrics));
+            server.on("/boot", HTTP_GET, counted(&Webserver::handleBoot));
 
             // POST
-            server.on("/savedata", std::bind(&Webserver::handleSaveData, this));
+            server.on("/savedata", counted(&Webserver::handleSaveData));
             
             // update
-            server.on("/update", std::bind(&Webserver::handleUpdate, this));
+            server.on("/update", counted(&Webserver::handleUpdate));
             // upgrade
-            server.on("/upgrade", HTTP_POST, std::bind(&Webserver::handleUpgradeFn, this), std::bind(&Webserver::handleUpgradeUFn, this));
+            server.on("/upgrade", HTTP_POST, counted(&Webserver::handleUpgradeFn), std::bind(&Webserver::handleUpgradeUFn, this));
 
             // reset
-            server.on("/reset", std::bind(&Webserver::handleReset, this));
+            server.on("/reset", counted(&Webserver::handleReset));
             
             // Error handling
-            server.onNotFound(std::bind(&Webserver::handleNotFound, this));
+            server.onNotFound(counted(&Webserver::handleNotFound));
+
+            // Needed for the conditional requests of the assets
+            const char* headers[] = {"If-None-Match"};
+            server.collectHeaders(headers, 1);
 
             // Favicon
-            server.on("/favicon.ico", std::bind(&Webserver::handleFavicon, this));
+            server.on("/favicon.ico", counted(&Webserver::handleFavicon));
 
             
             server.begin();
@@ -70,6 +86,16 @@ class Webserver {
             server.handleClient();
         }
 
+        // Request handler of a member function which counts the request before it is handled
+        // We should bind the member function in this way to able to pass to the request function.
+        // https://stackoverflow.com/questions/43479328/how-to-pass-class-member-function-as-handler-function
+        WebServer::THandlerFunction counted(void (Webserver::*handler)()) {
+            return [this, handler]() {
+                Metrics::increment(METRIC_HTTP_REQUESTS);
+                (this ->* handler)();
+            };
+        }
+
         String getData() {
             return this -> database -> getSerialized();
         }
@@ -84,31 +110,75 @@ class Webserver {
             server.sendHeader("Expires","-1");
         }
 
+        // Gzipped asset from the flash (see pre_build_web.py)
+        // The asset is not sent again if the browser has the same version (ETag).
+        // Immutable assets are referenced with their hash (?v=), so they can be cached forever.
+        void sendAsset(const char* contentType, const uint8_t* data, size_t length, const char* etag, bool immutable) {
+            server.sendHeader("ETag", etag);
+            server.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+
+            if (server.header("If-None-Match") == etag) {
+                server.send(304);
+                return;
+            }
+
+            // The heap is sampled after send() returns, so the peak covers the body only.
+            // The header String is already freed by then, its peak is not included.
+            uint32_t heapBefore = esp_get_free_heap_size();
+            server.sendHeader("Content-Encoding", "gzip");
+            server.setContentLength(length);
+            server.send(200, contentType, "");
+            streamAsset(data, length, heapBefore);
+        }
+
+        // Write the asset from the flash in fixed size chunks
+        // The flash is memory mapped, so the chunks are not copied to the heap. Only the TCP stack
+        // buffers a chunk, so the heap usage of a request is bounded by the chunk size and not by the asset size.
+        void streamAsset(const uint8_t* data, size_t length, uint32_t heapBefore) {
+            WiFiClient client = server.client();
+            uint32_t heapMin = min(heapBefore, esp_get_free_heap_size());
+
+            size_t sent = 0;
+            while (sent < length) {
+                size_t chunk = min((size_t) WEB_ASSET_CHUNK_SIZE, length - sent);
+                if (client.write(data + sent, chunk) != chunk) {
+                    this->rlog->log(log_prefix, (String) "Asset is not sent completely. Sent: " + sent + " of " + length);
+                    break;
+                }
+                sent += chunk;
+                heapMin = min(heapMin, esp_get_free_heap_size());
+            }
+
+            if (heapBefore > heapMin && heapBefore - heapMin > assetHeapPeak) {
+                assetHeapPeak = heapBefore - heapMin;
+            }
+        }
+
         void handleRoot(){            
             this->rlog->log(log_prefix, "/ is called");
             server.sendHeader("Access-Control-Allow-Origin", "*");
-            sendHeaders();
-            server.send(200, "text/html", data_index_html);
+            // The page must be revalidated, it has the versioned links of the other assets
+            sendAsset("text/html", data_index_html, data_index_html_len, data_index_html_etag, false);
         }
 
         void handleJavaScript(){
             this->rlog->log(log_prefix, "/function.js is called");            
-            server.send(200, "text/javascript", data_functions_js);
+            sendAsset("text/javascript", data_functions_js, data_functions_js_len, data_functions_js_etag, true);
         }
 
         void handleStyle(){
             this->rlog->log(log_prefix, "/style.css is called");
-            server.send(200, "text/css", data_style_css);
+            sendAsset("text/css", data_style_css, data_style_css_len, data_style_css_etag, true);
         }
 
         void handleNormalize(){
             this->rlog->log(log_prefix, "/normalize.css is called");
-            server.send(200, "text/css", data_normalize_css);
+            sendAsset("text/css", data_normalize_css, data_normalize_css_len, data_normalize_css_etag, true);
         }
 
         void handleSkeleton(){
             this->rlog->log(log_prefix, "/skeleton.css is called");
-            server.send(200, "text/css", data_skeleton_css);
+            sendAsset("text/css", data_skeleton_css, data_skeleton_css_len, data_skeleton_css_etag, true);
         }
 
         void handleLogo(){
@@ -128,6 +198,91 @@ class Webserver {
             server.send(200, "image/webp", "0");
         }
 
+        // Boot timeline (ms since the start of the chip)
+        void handleBoot() {
+            char timeline[BOOT_TIMELINE_BUFFER_SIZE];
+            BootTimeline::serialize(timeline, sizeof(timeline));
+            sendHeaders();
+            server.send(200, "application/json", timeline);
+        }
+
+        // Prometheus text exposition format
+        void handleMetrics() {
+            server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+            server.send(200, "text/plain; version=0.0.4", "");
+            metricsLength = 0;
+
+            for (int i = 0; i < METRIC_COUNT; i++) {
+                writeMetric("# TYPE dice_%s_total counter\ndice_%s_total %u\n", METRIC_NAMES[i], METRIC_NAMES[i], (unsigned int) Metrics::get((Metric) i));
+            }
+
+            for (int i = 0; i < GAUGE_COUNT; i++) {
+                writeMetric("# TYPE dice_%s gauge\ndice_%s %u\n", GAUGE_NAMES[i], GAUGE_NAMES[i], (unsigned int) Metrics::get((Gauge) i));
+            }
+
+            for (int i = 0; i < HISTOGRAM_COUNT; i++) {
+                writeHistogram((Histogram) i);
+            }
+
+            writeMetric("# TYPE dice_heap_free_bytes gauge\ndice_heap_free_bytes %u\n", (unsigned int) esp_get_free_heap_size());
+            writeMetric("# TYPE dice_heap_min_free_bytes gauge\ndice_heap_min_free_bytes %u\n", (unsigned int) esp_get_minimum_free_heap_size());
+            writeMetric("# TYPE dice_http_asset_heap_peak_bytes gauge\ndice_http_asset_heap_peak_bytes %u\n", (unsigned int) assetHeapPeak);
+            writeMetric("# TYPE dice_uptime_seconds gauge\ndice_uptime_seconds %llu\n", (unsigned long long) (esp_timer_get_time() / 1000000));
+            writeMetric("# TYPE dice_reset_reason gauge\ndice_reset_reason{reason=\"%s\"} 1\n", Metrics::getResetReason());
+
+            flushMetrics();
+            // Empty chunk closes the response
+            server.sendContent("");
+        }
+
+        void writeHistogram(Histogram histogram) {
+            uint32_t buckets[HISTOGRAM_BOUND_COUNT + 1];
+            uint64_t sum;
+            uint32_t count;
+            Metrics::readHistogram(histogram, buckets, sum, count);
+
+            const char* name = HISTOGRAM_NAMES[histogram];
+            writeMetric("# TYPE dice_%s_seconds histogram\n", name);
+            uint32_t cumulative = 0;
+            for (size_t i = 0; i < HISTOGRAM_BOUND_COUNT; i++) {
+                cumulative += buckets[i];
+                writeMetric("dice_%s_seconds_bucket{le=\"%g\"} %u\n", name, HISTOGRAM_BOUNDS[i] / 1000000.0, (unsigned int) cumulative);
+            }
+            writeMetric("dice_%s_seconds_bucket{le=\"+Inf\"} %u\n", name, (unsigned int) count);
+            writeMetric("dice_%s_seconds_sum %.6f\ndice_%s_seconds_count %u\n", name, sum / 1000000.0, name, (unsigned int) count);
+        }
+
+        // Append complete lines to the buffer, the buffer is sent first if they do not fit in it
+        // Text which does not fit even in the empty buffer is dropped, a cut line would break the exposition format.
+        void writeMetric(const char* format, ...) {
+            va_list args;
+            for (int tries = 0; tries < 2; tries++) {
+                va_start(args, format);
+                int length = vsnprintf(metricsBuffer + metricsLength, sizeof(metricsBuffer) - metricsLength, format, args);
+                va_end(args);
+
+                if (length < 0) {
+                    return;
+                }
+                if (metricsLength + length < sizeof(metricsBuffer)) {
+                    metricsLength += length;
+                    return;
+                }
+                if (metricsLength == 0) {
+                    rlog -> log(log_prefix, (String) "Metric is longer than the buffer, dropped: " + length);
+                    return;
+                }
+                flushMetrics();
+            }
+        }
+
+        void flushMetrics() {
+            if (metricsLength > 0) {
+                server.sendContent(metricsBuffer, metricsLength);
+                metricsLength = 0;
+            }
+        }
+
          // POST handle methods
         void handleSaveData(){
             this->rlog->log(log_prefix, (String) "/savedata is called. args: " + server.args());
@@ -135,9 +290,9 @@ class Webserver {
             database->jsonToDatabase(postBody);
             sendHeaders();
             server.send(200, "application/json", getData());
-            
-            delay(500);
-            ESP -> restart();
+
+            // The modules are notified about the changes, no reboot is needed
+            database -> flush();
         }
 
         void handleReset() {
@@ -149,13 +304,14 @@ class Webserver {
 
         void handleUpdate() {
             this->rlog->log(log_prefix, "/update is called");
-            server.send(200, "text/html", data_update_html);
+            sendAsset("text/html", data_update_html, data_update_html_len, data_update_html_etag, false);
         }
 
         void handleUpgradeFn() {
             this->rlog->log(log_prefix, "/upgrade (fn) is called");
             server.sendHeader("Connection", "close");
             server.send(200, "text/plain", (Update.hasError()) ? "FAIL" : "OK");
+            database -> flush();
             ESP -> restart();
         }
 
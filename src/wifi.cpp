@@ -8,6 +8,8 @@
 #include <DNSServer.h>
 #include "log.cpp"
 #include "database.cpp"
+#include "metrics.cpp"
+#include "boot.cpp"
 
 class Wifi {
 
@@ -27,6 +29,7 @@ class Wifi {
         String password;
 
         int tries = 0;
+        volatile bool reconnecting = false; // Disconnected on purpose to connect with the new settings
 
         Wifi(Log &log) {
             this -> rlog = &log;
@@ -36,8 +39,9 @@ class Wifi {
 
             this -> database = &database;
 
-            this -> ssid = this -> database -> getValueAsString(String(DB_WIFI_NAME), false);
-            this -> password = this -> database -> getValueAsString(String(DB_WIFI_PASSWORD), false);
+            const Config &config = this -> database -> getConfig();
+            this -> ssid = config.ssid;
+            this -> password = config.password;
 
             this -> wifiStatusChanged = &wifiStatusChanged;
             this -> errorCodeChanged = &errorCodeChanged;
@@ -51,6 +55,7 @@ class Wifi {
             WiFi.mode(WIFI_AP_STA);
 
             setupMDNS();
+            BootTimeline::mark(BOOT_WIFI_STARTED);
         }
 
         void connectWifi() {            
@@ -68,8 +73,10 @@ class Wifi {
             rlog -> log(log_prefix, "Wifi is disconnected from a function.");
         }
 
+        // A running AP (captive portal) is kept while the station connects, wifiOnConnect() stops it
+        // Otherwise the portal would disappear on a config change or a retry, even if the new settings are wrong.
         void connectToAP() {
-            WiFi.mode(WIFI_STA);
+            WiFi.mode((WiFi.getMode() & WIFI_AP) ? WIFI_AP_STA : WIFI_STA);
             WiFi.begin(const_cast<char*>(ssid.c_str()), const_cast<char*>(password.c_str()));            
         }
 
@@ -85,6 +92,26 @@ class Wifi {
             rlog -> log(log_prefix, "AP disconnected from a function.");           
         }
 
+        // Config is changed (e.g. on the web UI), connect with the new credentials
+        void receiveConfigChange(uint32_t changes) {
+            // Not started yet, setup reads the actual config
+            if (!(changes & CONFIG_CHANGED_WIFI) || database == NULL) {
+                return;
+            }
+
+            const Config &config = this -> database -> getConfig();
+            this -> ssid = config.ssid;
+            this -> password = config.password;
+            this -> tries = 0;
+
+            rlog -> log(log_prefix, "Wifi settings are changed, reconnect.");
+            if (wifi_connected) {
+                reconnecting = true;
+                WiFi.disconnect();
+            }
+            connectWifi();
+        }
+
         boolean isConnected(){
             return wifi_connected;
         }     
@@ -143,6 +170,7 @@ class Wifi {
 
         // when wifi connects
         void wifiOnConnect() {
+            BootTimeline::mark(BOOT_IP_ACQUIRED);
             tries = 0;            
             stopAP();
             wifi_connected = true;
@@ -162,6 +190,13 @@ class Wifi {
             
             // Emit an event about the Wifi status
             wifiStatusChanged->fire(wifi_connected);
+
+            // The config change has already started the new connection, it is not a failed try
+            if (reconnecting) {
+                reconnecting = false;
+                return;
+            }
+            Metrics::increment(METRIC_WIFI_DISCONNECTS);
             
             // Try agan till WIFI_MAX_TRY
             this->tries++;
@@ -0,0 +1,73 @@
+#ifndef ARDUINO_HOST_SHIM
+#define ARDUINO_HOST_SHIM
+
+// Host shim of the Arduino API used by the classes under test (pio test -e native)
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <type_traits>
+
+typedef bool boolean;
+
+// Arduino String on top of std::string, with the members the sources use
+class String : public std::string {
+    public:
+        String() {}
+        String(const char* text) : std::string(text != NULL ? text : "") {}
+        String(const std::string &text) : std::string(text) {}
+
+        void trim() {
+            size_t first = find_first_not_of(" \t\r\n");
+            if (first == npos) {
+                clear();
+                return;
+            }
+            assign(substr(first, find_last_not_of(" \t\r\n") - first + 1));
+        }
+};
+
+// String + number appends the decimal form like Arduino does
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, String>::type
+operator+(const std::string &text, T value) {
+    return String(text + std::to_string(value));
+}
+
+// The tests move the clock by hand (us), millis(), micros() and esp_timer read the same clock
+inline int64_t &hostMicros() {
+    static int64_t now = 0;
+    return now;
+}
+
+inline unsigned long millis() {
+    return hostMicros() / 1000;
+}
+
+inline unsigned long micros() {
+    return hostMicros();
+}
+
+inline long random(long min, long max) {
+    return min + rand() % (max - min);
+}
+
+#define constrain(value, low, high) ((value) < (low) ? (low) : ((value) > (high) ? (high) : (value)))
+
+// FreeRTOS critical sections, the tests run on a single thread
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void) (mux))
+#define portEXIT_CRITICAL(mux) ((void) (mux))
+
+typedef uint32_t TickType_t;
+#define portTICK_PERIOD_MS 1
+
+// Sleep like FreeRTOS does: the task wakes up on a tick interrupt
+inline void vTaskDelay(TickType_t ticks) {
+    hostMicros() = (hostMicros() / (portTICK_PERIOD_MS * 1000) + ticks) * portTICK_PERIOD_MS * 1000;
+}
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef BLUETOOTHSERIAL_HOST_SHIM
+#define BLUETOOTHSERIAL_HOST_SHIM
+
+// Host shim of the Bluetooth serial port, it never has a client
+#include <Arduino.h>
+
+class BluetoothSerial {
+    public:
+        bool hasClient() {
+            return false;
+        }
+
+        void println(const String &) {}
+};
+
+#endif
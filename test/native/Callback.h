@@ -0,0 +1,46 @@
+#ifndef CALLBACK_HOST_SHIM
+#define CALLBACK_HOST_SHIM
+
+// Host shim of the Signal/Slot subset of tomstewart89/Callback used by the classes under test
+template <typename T>
+class Slot {
+    public:
+        virtual ~Slot() {}
+        virtual void operator()(T value) = 0;
+};
+
+template <typename T>
+class FunctionSlot : public Slot<T> {
+
+    void (*function)(T);
+
+    public:
+        FunctionSlot(void (*function)(T)) : function(function) {}
+
+        void operator()(T value) {
+            function(value);
+        }
+};
+
+template <typename T>
+class Signal {
+
+    static const int MAX_SLOTS = 4;
+    Slot<T>* slots[MAX_SLOTS];
+    int count = 0;
+
+    public:
+        void attach(Slot<T> &slot) {
+            if (count < MAX_SLOTS) {
+                slots[count++] = &slot;
+            }
+        }
+
+        void fire(T value) {
+            for (int i = 0; i < count; i++) {
+                (*slots[i])(value);
+            }
+        }
+};
+
+#endif
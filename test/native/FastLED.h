@@ -0,0 +1,65 @@
+#ifndef FASTLED_HOST_SHIM
+#define FASTLED_HOST_SHIM
+
+// Host shim of the CRGB pixel type and the controller of FastLED, the strip itself is not driven
+#include <stdint.h>
+
+struct CRGB {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    enum HTMLColorCode {
+        Black = 0x000000
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+
+    CRGB(uint32_t colorcode) {
+        setColorCode(colorcode);
+    }
+
+    CRGB &setColorCode(uint32_t colorcode) {
+        r = (colorcode >> 16) & 0xFF;
+        g = (colorcode >> 8) & 0xFF;
+        b = colorcode & 0xFF;
+        return *this;
+    }
+
+    bool operator==(const CRGB &other) const {
+        return r == other.r && g == other.g && b == other.b;
+    }
+
+    bool operator!=(const CRGB &other) const {
+        return !(*this == other);
+    }
+};
+
+inline void fill_solid(CRGB* leds, int count, const CRGB &color) {
+    for (int i = 0; i < count; i++) {
+        leds[i] = color;
+    }
+}
+
+// Counts the pushes, so the tests can check when the strip would be written
+class CFastLED {
+    uint8_t brightness = 255;
+    uint32_t shows = 0;
+
+    public:
+        void setBrightness(uint8_t brightness) {
+            this -> brightness = brightness;
+        }
+
+        void show() {
+            shows++;
+        }
+
+        uint32_t getShows() {
+            return shows;
+        }
+};
+
+static CFastLED FastLED;
+
+#endif
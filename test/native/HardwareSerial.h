@@ -0,0 +1,15 @@
+#ifndef HARDWARESERIAL_HOST_SHIM
+#define HARDWARESERIAL_HOST_SHIM
+
+// Host shim of the serial port, the log lines of the classes under test are dropped
+#include <Arduino.h>
+
+class HardwareSerial {
+    public:
+        void begin(unsigned long) {}
+        void println(const String &) {}
+};
+
+static HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef BENCHMARK_HOST
+#define BENCHMARK_HOST
+
+// Timing of the before/after comparisons of the host tests
+// The numbers are host numbers, only their ratio says something about the ESP32.
+#include <unity.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+#define BENCHMARK_ROUNDS 100000
+
+// Keeps the result of the measured code alive, so the compiler can not drop the calls
+static volatile uint32_t benchmarkSink;
+
+// Average duration of one call (ns). The code gets the round index and returns a value of its result.
+template <typename Code>
+double benchmarkNs(Code code) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < BENCHMARK_ROUNDS; i++) {
+        benchmarkSink = benchmarkSink + code(i);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / BENCHMARK_ROUNDS;
+}
+
+// Measure both versions, print the numbers and fail if the new one is not faster
+template <typename Before, typename After>
+void assertFaster(const char* unit, const char* beforeName, Before before, const char* afterName, After after) {
+    double beforeNs = benchmarkNs(before);
+    double afterNs = benchmarkNs(after);
+
+    char message[128];
+    snprintf(message, sizeof(message), "%s: %.1f ns/%s, %s: %.1f ns/%s", beforeName, beforeNs, unit, afterName, afterNs, unit);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_TRUE(afterNs < beforeNs);
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef ESP_SYSTEM_HOST_SHIM
+#define ESP_SYSTEM_HOST_SHIM
+
+// Host shim of the ESP-IDF system API used by the metrics
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t esp_reset_reason() {
+    return ESP_RST_POWERON;
+}
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef ESP_TIMER_HOST_SHIM
+#define ESP_TIMER_HOST_SHIM
+
+// Host shim of the 64 bit esp_timer timebase, it reads the clock of the Arduino shim
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() {
+    return hostMicros();
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <benchmark.h>
+
+#include "router.cpp"
+
+// The same command in both formats: rollTheDiceAnimatedToSpinUp, every property set
+static const char JSON_COMMAND[] = "{\"command\":3,\"speed\":150,\"count\":10,\"infinity\":true,"
+    "\"color\":\"#00FF00\",\"number\":4,\"brightness\":200}";
+static const uint8_t BINARY_FRAME[BINARY_COMMAND_LENGTH] = {
+    BINARY_COMMAND_MAGIC, BINARY_COMMAND_VERSION, 3,
+    0x80 | DICE_FIELD_COMMAND | DICE_FIELD_SPEED | DICE_FIELD_COUNT | DICE_FIELD_INFINITY | DICE_FIELD_COLOR | DICE_FIELD_NUMBER | DICE_FIELD_BRIGHTNESS,
+    4, 200, 150, 0, 10, 0, 0x00, 0xFF, 0x00
+};
+
+static Log hostLog;
+static CommandRouter router(hostLog);
+static Signal<JsonObject> configCommandArrived;
+static Signal<DiceCommand> diceCommandArrived;
+static int routed = 0;
+static DiceCommand lastRouted = {};
+
+static void receiveCommand(DiceCommand command) {
+    routed++;
+    lastRouted = command;
+}
+
+static FunctionSlot<DiceCommand> receiveCommandSlot(receiveCommand);
+
+// Route a message like the MQTT client does, the router parses the payload in place so it gets a copy
+static void route(const char* topic, const void* payload, size_t length) {
+    char buffer[sizeof(JSON_COMMAND)];
+    memcpy(buffer, payload, length);
+    buffer[length] = '\0';
+    router.route({buffer, length, topic});
+}
+
+static void assertSameCommand(const DiceCommand &expected, const DiceCommand &actual) {
+    TEST_ASSERT_EQUAL_UINT8(expected.fields, actual.fields);
+    TEST_ASSERT_EQUAL_UINT8(expected.command, actual.command);
+    TEST_ASSERT_EQUAL_UINT8(expected.number, actual.number);
+    TEST_ASSERT_EQUAL_UINT8(expected.brightness, actual.brightness);
+    TEST_ASSERT_EQUAL(expected.infinity, actual.infinity);
+    TEST_ASSERT_EQUAL_UINT16(expected.speed, actual.speed);
+    TEST_ASSERT_EQUAL_UINT16(expected.count, actual.count);
+    TEST_ASSERT_EQUAL_UINT32(expected.color, actual.color);
+}
+
+void setUp() {
+    routed = 0;
+    lastRouted = {};
+}
+
+void tearDown() {}
+
+void test_binary_frame_routes_like_json() {
+    route("", JSON_COMMAND, sizeof(JSON_COMMAND) - 1);
+    TEST_ASSERT_EQUAL(1, routed);
+    DiceCommand fromJson = lastRouted;
+
+    route(MQTT_BINARY_POSTFIX, BINARY_FRAME, sizeof(BINARY_FRAME));
+    TEST_ASSERT_EQUAL(2, routed);
+    assertSameCommand(fromJson, lastRouted);
+
+    DiceCommand decoded;
+    TEST_ASSERT_TRUE(BinaryCommand::decode(BINARY_FRAME, sizeof(BINARY_FRAME), decoded));
+    assertSameCommand(fromJson, decoded);
+}
+
+void test_invalid_binary_frames_are_rejected() {
+    uint8_t frame[BINARY_COMMAND_LENGTH];
+    DiceCommand command;
+
+    memcpy(frame, BINARY_FRAME, sizeof(frame));
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame) - 1, command));
+    frame[0] = '{';
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame), command));
+    frame[0] = BINARY_COMMAND_MAGIC;
+    frame[1] = BINARY_COMMAND_VERSION + 1;
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame), command));
+
+    // Out of range values are rejected like on the text topics
+    memcpy(frame, BINARY_FRAME, sizeof(frame));
+    frame[2] = DICE_COMMAND_COUNT;
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame), command));
+    memcpy(frame, BINARY_FRAME, sizeof(frame));
+    frame[4] = 7;
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame), command));
+    frame[4] = 0;
+    TEST_ASSERT_FALSE(BinaryCommand::decode(frame, sizeof(frame), command));
+
+    // The router drops the frame and counts it
+    uint32_t parseErrors = Metrics::get(METRIC_PARSE_ERRORS);
+    route(MQTT_BINARY_POSTFIX, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(0, routed);
+    TEST_ASSERT_EQUAL_UINT32(parseErrors + 1, Metrics::get(METRIC_PARSE_ERRORS));
+
+    // Invalid values of the fields which are not set do not matter
+    frame[3] &= ~DICE_FIELD_NUMBER;
+    TEST_ASSERT_TRUE(BinaryCommand::decode(frame, sizeof(frame), command));
+}
+
+// Routing cost per command, from the received payload to the fired DiceCommand
+void test_binary_route_is_cheaper_than_json() {
+    assertFaster("command",
+        "JSON", [](uint32_t) -> uint32_t {
+            route("", JSON_COMMAND, sizeof(JSON_COMMAND) - 1);
+            return lastRouted.color;
+        },
+        "binary", [](uint32_t) -> uint32_t {
+            route(MQTT_BINARY_POSTFIX, BINARY_FRAME, sizeof(BINARY_FRAME));
+            return lastRouted.color;
+        });
+}
+
+int main() {
+    router.setup(configCommandArrived, diceCommandArrived);
+    diceCommandArrived.attach(receiveCommandSlot);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_binary_frame_routes_like_json);
+    RUN_TEST(test_invalid_binary_frames_are_rejected);
+    RUN_TEST(test_binary_route_is_cheaper_than_json);
+    return UNITY_END();
+}
@@ -0,0 +1,112 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <FastLED.h>
+#include <benchmark.h>
+
+#include "modules/ledframe.cpp"
+#include "modules/animation.cpp"
+
+#define NUM_LEDS 21
+
+static CRGB leds[NUM_LEDS];
+static String currentColor = "#00FF00";
+
+// The face rendering before the pip mask table: a switch per face and a color string parse per lit LED
+static uint32_t getColorAsNumber(String colorCode) {
+    String colorString = "0x" + colorCode.substr(1);
+    return strtol(colorString.c_str(), NULL, 16);
+}
+
+static void setDiceNumberWithSwitch(int number, const String &currentColor) {
+    for (int i = 0; i < NUM_LEDS; i++) {
+        leds[i] = CRGB::Black;
+    }
+
+    switch (number) {
+        case 1:
+            leds[0].setColorCode(getColorAsNumber(currentColor));
+        break;
+        case 2:
+            for (int i = 1; i <= 2; i++) {
+                leds[i].setColorCode(getColorAsNumber(currentColor));
+            }
+        break;
+        case 3:
+            for (int i = 3; i <= 5; i++) {
+                leds[i].setColorCode(getColorAsNumber(currentColor));
+            }
+        break;
+        case 4:
+            for (int i = 6; i <= 9; i++) {
+                leds[i].setColorCode(getColorAsNumber(currentColor));
+            }
+        break;
+        case 5:
+            for (int i = 10; i <= 14; i++) {
+                leds[i].setColorCode(getColorAsNumber(currentColor));
+            }
+        break;
+        case 6:
+            for (int i = 15; i <= 20; i++) {
+                leds[i].setColorCode(getColorAsNumber(currentColor));
+            }
+        break;
+    }
+}
+
+// The face rendering of Dice::renderFrame: the effect step gives the mask and the color, the frame lights them
+static LedFrame<NUM_LEDS> frame;
+static Animation animation;
+
+static void renderFace(int number) {
+    uint32_t mask;
+    CRGB color;
+    animation.number = number;
+    animation.start(DICE_COMMAND_SHOW_NUMBER);
+    animation.step(mask, color);
+    frame.fillMask(mask, color);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// The mask table lights the same LEDs as the switch did
+void test_masks_match_the_switch() {
+    animation.color = CRGB(0x00FF00);
+    for (int number = 1; number <= 6; number++) {
+        setDiceNumberWithSwitch(number, currentColor);
+        renderFace(number);
+        TEST_ASSERT_TRUE(frame.show(255));
+        for (int i = 0; i < NUM_LEDS; i++) {
+            TEST_ASSERT_TRUE(leds[i] == frame.getPixels()[i]);
+        }
+    }
+
+    // The same face again does not change the frame, it is not pushed to the strip
+    uint32_t shows = FastLED.getShows();
+    renderFace(6);
+    TEST_ASSERT_FALSE(frame.show(255));
+    TEST_ASSERT_EQUAL_UINT32(shows, FastLED.getShows());
+}
+
+// Render cost per face, averaged over the six faces. Host numbers, on the ESP32 every String is a heap allocation too.
+void test_mask_render_is_cheaper_than_switch() {
+    animation.color = CRGB(0x00FF00);
+    assertFaster("face",
+        "switch", [](uint32_t i) -> uint32_t {
+            setDiceNumberWithSwitch(i % 6 + 1, currentColor);
+            return leds[20].g;
+        },
+        "mask", [](uint32_t i) -> uint32_t {
+            renderFace(i % 6 + 1);
+            return animation.number;
+        });
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_masks_match_the_switch);
+    RUN_TEST(test_mask_render_is_cheaper_than_switch);
+    return UNITY_END();
+}
@@ -0,0 +1,127 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <stdio.h>
+
+#include "definitions.h"
+#include "modules/framescheduler.cpp"
+
+// Simulated workload, the clock of the shims is moved by the costs
+#define SIMULATED_TIME 10000000LL // us
+#define FRAME_PERIOD (1000000LL / DICE_TARGET_FPS) // us
+#define RENDER_COST 700 // Animation step and FastLED.show() of the 21 LEDs (us)
+#define NETWORK_COST 1000 // One pass of the web server, MQTT and Bluetooth loops (us)
+#define NETWORK_STALL 50000 // MQTT reconnect or slow HTTP handler, once in every second (us)
+#define FLASH_STALL 12000 // Flash write of the database, it stops both cores, once in every second (us)
+
+struct Lateness {
+    int64_t max = 0;
+    int64_t sum = 0;
+    uint32_t frames = 0;
+
+    void add(int64_t lateness) {
+        if (lateness > max) {
+            max = lateness;
+        }
+        sum += lateness;
+        frames++;
+    }
+
+    int64_t average() {
+        return frames > 0 ? sum / frames : 0;
+    }
+};
+
+void setUp() {
+    hostMicros() = 0;
+}
+
+void tearDown() {}
+
+// Frames rendered by the Arduino loop like before the render task: the network work runs between the frames
+static Lateness measureLoop() {
+    Lateness lateness;
+    unsigned long lastAnimationTime = 0;
+    int64_t nextStall = 1000000LL;
+
+    while (hostMicros() < SIMULATED_TIME) {
+        hostMicros() += NETWORK_COST;
+        if (hostMicros() >= nextStall) {
+            hostMicros() += NETWORK_STALL + FLASH_STALL;
+            nextStall += 1000000LL;
+        }
+
+        if (millis() - lastAnimationTime > FRAME_PERIOD / 1000) {
+            lateness.add(hostMicros() - (lastAnimationTime + FRAME_PERIOD / 1000) * 1000LL);
+            lastAnimationTime = millis();
+            hostMicros() += RENDER_COST;
+        }
+    }
+    return lateness;
+}
+
+// Frames rendered by the render task: the network work runs on the other core, only the flash writes delay it
+static Lateness measureRenderTask(FrameScheduler &scheduler) {
+    Lateness lateness;
+    int64_t nextStall = 1000000LL;
+
+    scheduler.setup(DICE_TARGET_FPS, DICE_FRAME_POLICY);
+    while (hostMicros() < SIMULATED_TIME) {
+        scheduler.waitNextFrame();
+        lateness.add(scheduler.getLateness());
+        hostMicros() += RENDER_COST;
+        if (hostMicros() >= nextStall) {
+            hostMicros() += FLASH_STALL;
+            nextStall += 1000000LL;
+        }
+    }
+    return lateness;
+}
+
+// Frame start lateness of both designs under the same network load
+void test_render_task_jitter_is_lower_than_the_loop() {
+    Lateness loop = measureLoop();
+    hostMicros() = 0;
+    FrameScheduler scheduler;
+    Lateness task = measureRenderTask(scheduler);
+
+    char message[160];
+    snprintf(message, sizeof(message), "loop: max %lld us, avg %lld us, %u frames; render task: max %lld us, avg %lld us, %u frames",
+        (long long) loop.max, (long long) loop.average(), loop.frames,
+        (long long) task.max, (long long) task.average(), task.frames);
+    TEST_MESSAGE(message);
+
+    // A frame is late only by the tick rounding of the sleep, and by a flash write
+    TEST_ASSERT_LESS_OR_EQUAL(portTICK_PERIOD_MS * 1000 + FLASH_STALL, task.max);
+    TEST_ASSERT_TRUE(task.average() < loop.average());
+    TEST_ASSERT_TRUE(task.max < loop.max);
+
+    // The deadlines do not drift, every frame period gets its frame
+    TEST_ASSERT_GREATER_OR_EQUAL(SIMULATED_TIME / FRAME_PERIOD, task.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.getDroppedFrames());
+}
+
+// A stall longer than a frame period skips the missed frames and continues on the original grid
+void test_missed_frames_are_dropped_on_the_grid() {
+    FrameScheduler scheduler;
+    scheduler.setup(DICE_TARGET_FPS, FrameScheduler::drop);
+
+    int64_t start = scheduler.waitNextFrame();
+    hostMicros() += 3 * FRAME_PERIOD + RENDER_COST;
+    // The frame of the first period is rendered late, the next two are gone
+    int64_t late = scheduler.waitNextFrame();
+    TEST_ASSERT_EQUAL(start + FRAME_PERIOD, late);
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getMissedDeadlines());
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getDroppedFrames());
+
+    hostMicros() += RENDER_COST;
+    int64_t next = scheduler.waitNextFrame();
+    TEST_ASSERT_EQUAL(start + 4 * FRAME_PERIOD, next);
+    TEST_ASSERT_EQUAL(0, scheduler.getLateness());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_render_task_jitter_is_lower_than_the_loop);
+    RUN_TEST(test_missed_frames_are_dropped_on_the_grid);
+    return UNITY_END();
+}
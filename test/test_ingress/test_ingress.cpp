@@ -0,0 +1,133 @@
+#include <unity.h>
+#include <Arduino.h>
+
+#include "ingress.cpp"
+
+static Log hostLog;
+static int passed = 0;
+static DiceCommand lastPassed = {};
+
+// The counters are global, every test reads them relative to its start
+static uint32_t counterBase[METRIC_COUNT];
+
+static uint32_t counted(Metric metric) {
+    return Metrics::get(metric) - counterBase[metric];
+}
+
+static void receiveCommand(DiceCommand command) {
+    passed++;
+    lastPassed = command;
+}
+
+static DiceCommand speedCommand(uint16_t speed) {
+    DiceCommand command = {};
+    command.fields = DICE_FIELD_SPEED;
+    command.speed = speed;
+    return command;
+}
+
+// Run the ingress loop every millisecond until the given time
+static void runUntil(CommandIngress &ingress, unsigned long until) {
+    while (millis() < until) {
+        hostMicros() += 1000;
+        ingress.loop();
+    }
+}
+
+void setUp() {
+    hostMicros() = 0;
+    passed = 0;
+    lastPassed = {};
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        counterBase[i] = Metrics::get((Metric) i);
+    }
+}
+
+void tearDown() {}
+
+// A slider which sends a command every millisecond for a second
+void test_flood_is_bounded_by_the_token_bucket() {
+    Signal<DiceCommand> commandReady;
+    FunctionSlot<DiceCommand> receiver(receiveCommand);
+    commandReady.attach(receiver);
+    CommandIngress ingress(hostLog);
+    ingress.setup(commandReady);
+
+    for (uint16_t i = 1; i <= 1000; i++) {
+        ingress.submit(speedCommand(i));
+        hostMicros() += 1000;
+        ingress.loop();
+    }
+
+    // Burst at the start, then the refill rate, far below the 100 flushes the frame period would allow
+    TEST_ASSERT_LESS_OR_EQUAL(INGRESS_BURST + INGRESS_RATE, passed);
+    TEST_ASSERT_GREATER_OR_EQUAL(INGRESS_RATE, passed);
+    TEST_ASSERT_EQUAL_UINT32(1000, counted(METRIC_COMMANDS_RECEIVED));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, counted(METRIC_COMMANDS_LIMITED));
+
+    // The last value of the slider is not lost, it is passed when the next token arrives
+    runUntil(ingress, 2000);
+    TEST_ASSERT_EQUAL_UINT16(1000, lastPassed.speed);
+    TEST_ASSERT_EQUAL_UINT32(counted(METRIC_COMMANDS_RECEIVED) - passed, counted(METRIC_COMMANDS_MERGED));
+}
+
+// The latest value of every property wins, the other properties are kept
+void test_commands_are_merged_within_a_frame() {
+    Signal<DiceCommand> commandReady;
+    FunctionSlot<DiceCommand> receiver(receiveCommand);
+    commandReady.attach(receiver);
+    CommandIngress ingress(hostLog);
+    ingress.setup(commandReady);
+
+    DiceCommand effect = {};
+    effect.fields = DICE_FIELD_COMMAND | DICE_FIELD_COLOR;
+    effect.command = 2;
+    effect.color = 0x00FF00;
+    ingress.submit(speedCommand(100));
+    ingress.submit(effect);
+    effect.command = 3;
+    ingress.submit(effect);
+    ingress.submit(speedCommand(200));
+    runUntil(ingress, INGRESS_FLUSH_PERIOD);
+
+    TEST_ASSERT_EQUAL(1, passed);
+    TEST_ASSERT_EQUAL_UINT8(DICE_FIELD_COMMAND | DICE_FIELD_COLOR | DICE_FIELD_SPEED, lastPassed.fields);
+    TEST_ASSERT_EQUAL_UINT8(3, lastPassed.command);
+    TEST_ASSERT_EQUAL_UINT16(200, lastPassed.speed);
+    TEST_ASSERT_EQUAL_UINT32(0x00FF00, lastPassed.color);
+    TEST_ASSERT_EQUAL_UINT32(3, counted(METRIC_COMMANDS_MERGED));
+    TEST_ASSERT_EQUAL_UINT32(1, counted(METRIC_COMMANDS_DROPPED));
+}
+
+// After a quiet period a burst passes at the frame rate, the next commands wait for the refill
+void test_burst_after_a_quiet_period() {
+    Signal<DiceCommand> commandReady;
+    FunctionSlot<DiceCommand> receiver(receiveCommand);
+    commandReady.attach(receiver);
+    CommandIngress ingress(hostLog);
+    ingress.setup(commandReady);
+
+    runUntil(ingress, 5000);
+    for (int i = 1; i <= INGRESS_BURST; i++) {
+        ingress.submit(speedCommand(i));
+        runUntil(ingress, millis() + INGRESS_FLUSH_PERIOD);
+        TEST_ASSERT_EQUAL(i, passed);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, counted(METRIC_COMMANDS_LIMITED));
+
+    // Keep sending at the frame rate, only the refill passes
+    for (int i = 0; i < 2 * INGRESS_BURST; i++) {
+        ingress.submit(speedCommand(i));
+        runUntil(ingress, millis() + INGRESS_FLUSH_PERIOD);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, counted(METRIC_COMMANDS_LIMITED));
+    TEST_ASSERT_LESS_OR_EQUAL(INGRESS_BURST + 3 * INGRESS_BURST * INGRESS_FLUSH_PERIOD * INGRESS_RATE / 1000 + 1, passed);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_flood_is_bounded_by_the_token_bucket);
+    RUN_TEST(test_commands_are_merged_within_a_frame);
+    RUN_TEST(test_burst_after_a_quiet_period);
+    return UNITY_END();
+}